@@ -0,0 +1,38 @@
+#!/usr/bin/python
+#
+# Replaces the linear search in the getEnum() functions emitted by
+# cparser --print-jna with a lookup through firm.bindings.EnumLookup.
+#
+# usage: enum_lookup.py file.java...
+import re
+import sys
+
+getenum = re.compile(r'''
+(?P<indent>[ \t]*)public\ static\ (?P<name>\w+)\ getEnum\(int\ val\)\ \{\s*
+\s*for\s*\(\s*(?P=name)\ entry\ :\ values\(\)\)\ \{\s*
+\s*if\ \(val\ ==\ entry\.val\)\s*
+\s*return\ entry;\s*
+\s*\}\s*
+\s*return\ null;\s*
+\s*\}''', re.VERBOSE)
+
+def replace(match):
+	indent = match.group("indent")
+	name   = match.group("name")
+	return (
+		"%(i)sprivate static final EnumLookup<%(n)s> lookup = new EnumLookup<%(n)s>(values());\n"
+		"\n"
+		"%(i)spublic static %(n)s getEnum(int val) {\n"
+		"%(i)s\treturn lookup.get(val);\n"
+		"%(i)s}") % dict(i = indent, n = name)
+
+for filename in sys.argv[1:]:
+	file = open(filename)
+	text = file.read()
+	file.close()
+
+	text = getenum.sub(replace, text)
+
+	file = open(filename, "w")
+	file.write(text)
+	file.close()
@@ -15,5 +15,6 @@ for i in lowering irgmod iredges irmode tv ircons irnode firm_common irdump irop
 	sed -e "s/class binding/class binding_$i/g" -i $TMP
 	echo "package firm.bindings;" > header
 	cat header $TMP > $RES
+	python enum_lookup.py $RES || exit $?
 done
 
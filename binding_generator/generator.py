@@ -175,7 +175,7 @@ def get_java_type(type):
 		java_type    = "firm.Mode"
 		wrap_type    = "Pointer"
 		to_wrapper   = "%s.ptr"
-		from_wrapper = "new firm.Mode(%s)"
+		from_wrapper = "firm.Mode.createWrapper(%s)"
 	elif type == "ir_tarval*":
 		java_type    = "firm.TargetValue"
 		wrap_type    = "Pointer"
@@ -459,20 +459,35 @@ import firm.bindings.binding_irnode;
 
 class NodeWrapperConstruction {
 
-	public static Node createWrapper(Pointer ptr) {
-		final binding_irnode.ir_opcode opcode = 
-			binding_irnode.ir_opcode.getEnum(binding_irnode.get_irn_opcode(ptr));
+	private static abstract class Factory {
+		abstract Node create(Pointer ptr);
+	}
+
+	/** wrapper factories indexed by the raw opcode number */
+	private static final Factory[] factories = createFactories();
 
-		switch (opcode) {
+	private static Factory[] createFactories() {
+		final Factory[] result = new Factory[binding_irnode.ir_opcode.iro_MaxOpcode.val];
 		{% for node in nodes %}
 		{% if not isAbstract(node) %}
-			case iro_{{node.name}}:
+		result[binding_irnode.ir_opcode.iro_{{node.name}}.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new {{node.classname}}(ptr);
+			}
+		};
 		{% endif %}
 		{% endfor %}
-			default:
-				throw new IllegalStateException("Unkown node type: " + opcode);
+		return result;
+	}
+
+	public static Node createWrapper(Pointer ptr) {
+		final int opcode = binding_irnode.get_irn_opcode(ptr);
+		if (opcode < 0 || opcode >= factories.length || factories[opcode] == null) {
+			throw new IllegalStateException("Unkown node type: "
+					+ binding_irnode.ir_opcode.getEnum(opcode));
 		}
+		return factories[opcode].create(ptr);
 	}
 }''')
 file = open("NodeWrapperConstruction.java", "w")
@@ -0,0 +1,149 @@
+package firm;
+
+import java.util.HashMap;
+import java.util.Map;
+
+import com.sun.jna.Pointer;
+
+import firm.bindings.binding_irmemory;
+import firm.bindings.binding_irmemory.ir_alias_relation;
+import firm.nodes.Node;
+
+/**
+ * Answers alias queries for the memory accesses of a graph
+ * (get_alias_relation from irmemory.h). The entity usage information is
+ * computed once when the oracle is created and every answer is cached in a
+ * java hash table, so asking for the same pair of addresses again costs no
+ * native call. The relation is symmetric, (a, b) and (b, a) share an entry.
+ *
+ * Cached answers are not updated when the graph changes, call clear()
+ * after modifying addresses.
+ */
+public class AliasOracle {
+
+	/** the graph */
+	public final Graph graph;
+
+	private final Map<Key, ir_alias_relation> cache = new HashMap<Key, ir_alias_relation>();
+
+	/** a (symmetric) query: two address nodes with their access modes */
+	private static final class Key {
+		private final long adr1;
+		private final long mode1;
+		private final long adr2;
+		private final long mode2;
+
+		public Key(Pointer adr1, Pointer mode1, Pointer adr2, Pointer mode2) {
+			long a1 = Pointer.nativeValue(adr1);
+			long m1 = Pointer.nativeValue(mode1);
+			long a2 = Pointer.nativeValue(adr2);
+			long m2 = Pointer.nativeValue(mode2);
+			/* order the pair so that (a, b) and (b, a) are the same key */
+			if (a1 < a2 || (a1 == a2 && m1 <= m2)) {
+				this.adr1 = a1;
+				this.mode1 = m1;
+				this.adr2 = a2;
+				this.mode2 = m2;
+			} else {
+				this.adr1 = a2;
+				this.mode1 = m2;
+				this.adr2 = a1;
+				this.mode2 = m1;
+			}
+		}
+
+		@Override
+		public boolean equals(Object obj) {
+			if (!(obj instanceof Key))
+				return false;
+			Key other = (Key) obj;
+			return adr1 == other.adr1 && mode1 == other.mode1
+				&& adr2 == other.adr2 && mode2 == other.mode2;
+		}
+
+		@Override
+		public int hashCode() {
+			long hash = adr1;
+			hash = hash * 31 + mode1;
+			hash = hash * 31 + adr2;
+			hash = hash * 31 + mode2;
+			return (int) (hash ^ (hash >>> 32));
+		}
+	}
+
+	/** creates an oracle for a graph (computes the entity usage information) */
+	public AliasOracle(Graph graph) {
+		this.graph = graph;
+		binding_irmemory.assure_irg_entity_usage_computed(graph.ptr);
+	}
+
+	/**
+	 * returns the alias relation of two memory accesses
+	 * @param adr1   address of the first access
+	 * @param mode1  mode of the first access
+	 * @param adr2   address of the second access
+	 * @param mode2  mode of the second access
+	 */
+	public ir_alias_relation getRelation(Node adr1, Mode mode1, Node adr2, Mode mode2) {
+		Key key = new Key(adr1.ptr, mode1.ptr, adr2.ptr, mode2.ptr);
+		ir_alias_relation result = cache.get(key);
+		if (result == null) {
+			int rel = binding_irmemory.get_alias_relation(adr1.ptr, mode1.ptr, adr2.ptr, mode2.ptr);
+			result = ir_alias_relation.getEnum(rel);
+			cache.put(key, result);
+		}
+		return result;
+	}
+
+	/** returns true if the two accesses may (or surely do) alias */
+	public boolean mayAlias(Node adr1, Mode mode1, Node adr2, Mode mode2) {
+		return getRelation(adr1, mode1, adr2, mode2) != ir_alias_relation.ir_no_alias;
+	}
+
+	/**
+	 * answers a batch of queries: result[i] is the relation of access i of
+	 * the first arrays with access i of the second arrays. Cached and
+	 * duplicate pairs are answered without a native call.
+	 */
+	public ir_alias_relation[] getRelations(Node[] adrs1, Mode[] modes1, Node[] adrs2, Mode[] modes2) {
+		int n = adrs1.length;
+		if (modes1.length != n || adrs2.length != n || modes2.length != n)
+			throw new IllegalArgumentException("query arrays have different lengths");
+		ir_alias_relation[] result = new ir_alias_relation[n];
+		for (int i = 0; i < n; ++i) {
+			result[i] = getRelation(adrs1[i], modes1[i], adrs2[i], modes2[i]);
+		}
+		return result;
+	}
+
+	/**
+	 * returns the relations of all pairs of the given accesses in a matrix
+	 * (result[i][j] is the relation of access i with access j). Only the
+	 * n*(n-1)/2 distinct pairs are queried.
+	 */
+	public ir_alias_relation[][] getRelationMatrix(Node[] adrs, Mode[] modes) {
+		int n = adrs.length;
+		if (modes.length != n)
+			throw new IllegalArgumentException("query arrays have different lengths");
+		ir_alias_relation[][] result = new ir_alias_relation[n][n];
+		for (int i = 0; i < n; ++i) {
+			result[i][i] = ir_alias_relation.ir_sure_alias;
+			for (int j = i + 1; j < n; ++j) {
+				ir_alias_relation rel = getRelation(adrs[i], modes[i], adrs[j], modes[j]);
+				result[i][j] = rel;
+				result[j][i] = rel;
+			}
+		}
+		return result;
+	}
+
+	/** returns the number of cached answers */
+	public int getCacheSize() {
+		return cache.size();
+	}
+
+	/** drops all cached answers */
+	public void clear() {
+		cache.clear();
+	}
+}
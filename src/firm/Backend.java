@@ -24,6 +24,17 @@ public class Backend {
 		binding_libc.fclose(file);
 	}
 	
+	/**
+	 * Like createAssembler(outputFileName, compilationUnitName) but skips
+	 * optimisation and code generation for functions whose code is found in
+	 * the cache. The cached graphs are temporarily taken out of the program
+	 * and put back afterwards (at the end of the graph list). See CodeCache.
+	 */
+	public static void createAssembler(String outputFileName, String compilationUnitName,
+	                                   CodeCache cache) throws IOException {
+		cache.createAssembler(outputFileName, compilationUnitName);
+	}
+	
 	public static void option(String option) {
 		if (binding_be.be_parse_arg(option) != 1) {
 			throw new IllegalArgumentException("Unknown option '" + option + "'");
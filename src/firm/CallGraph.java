@@ -0,0 +1,293 @@
+package firm;
+
+import java.util.Arrays;
+import java.util.HashMap;
+import java.util.Map;
+
+import com.sun.jna.Pointer;
+import com.sun.jna.ptr.PointerByReference;
+
+import firm.bindings.binding_callgraph;
+import firm.bindings.binding_cgana;
+import firm.bindings.binding_irgraph.irg_callee_info_state;
+import firm.bindings.binding_irprog;
+import firm.bindings.binding_libc;
+
+/**
+ * The callgraph of the program (callgraph.h) exported into int arrays.
+ * Graphs are numbered like in Program.getGraph(n). The callees of graph g
+ * are callees[calleeStart[g]] .. callees[calleeStart[g+1] - 1], callers
+ * are stored the same way.
+ *
+ * The strongly connected components (sets of mutually recursive functions)
+ * are numbered bottom-up: the callees of a component (outside of it) are in
+ * components with smaller numbers. So processing the components in
+ * increasing order visits callees before their callers.
+ *
+ * The arrays are not updated when the program changes, compute a new
+ * CallGraph afterwards.
+ */
+public final class CallGraph {
+
+	/** number of graphs */
+	public final int size;
+
+	/** start of the callee list of each graph (length size + 1) */
+	public final int[] calleeStart;
+
+	/** graph numbers of the callees (see calleeStart) */
+	public final int[] callees;
+
+	/** start of the caller list of each graph (length size + 1) */
+	public final int[] callerStart;
+
+	/** graph numbers of the callers (see callerStart) */
+	public final int[] callers;
+
+	/** number of strongly connected components */
+	public final int nSccs;
+
+	/** number of the component of each graph */
+	public final int[] sccOf;
+
+	/**
+	 * graph numbers in bottom-up order, the members of component c are
+	 * sccMembers[sccStart[c]] .. sccMembers[sccStart[c+1] - 1]
+	 */
+	public final int[] sccMembers;
+
+	/** start of the member list of each component (length nSccs + 1) */
+	public final int[] sccStart;
+
+	/**
+	 * level of each component: 0 for components calling no other component,
+	 * otherwise 1 + the maximal level of the called components. Components
+	 * with the same level don't call each other and can be processed
+	 * independently.
+	 */
+	public final int[] sccLevel;
+
+	private final Pointer[] graphs;
+
+	/**
+	 * computes the callgraph of the program. This needs consistent callee
+	 * information (set up by the frontend or with computeWithCgana()),
+	 * otherwise an IllegalStateException is thrown.
+	 */
+	public static CallGraph compute() {
+		if (binding_irprog.get_irp_callee_info_state() != irg_callee_info_state.irg_callee_info_consistent.val)
+			throw new IllegalStateException("callee information is not consistent, use computeWithCgana()");
+		binding_callgraph.compute_callgraph();
+		return new CallGraph();
+	}
+
+	/**
+	 * runs the callee analysis cgana() and computes the callgraph.
+	 * Note that cgana also optimizes the program: it replaces Sel nodes
+	 * of methods with a single possible callee by constants.
+	 */
+	public static CallGraph computeWithCgana() {
+		int[] len = new int[1];
+		PointerByReference freeMethods = new PointerByReference();
+		binding_cgana.cgana(len, freeMethods);
+		if (freeMethods.getValue() != null)
+			binding_libc.free(freeMethods.getValue());
+		binding_callgraph.compute_callgraph();
+		return new CallGraph();
+	}
+
+	/** frees the native callgraph (the exported arrays stay valid) */
+	public static void free() {
+		binding_callgraph.free_callgraph();
+	}
+
+	private CallGraph() {
+		size = binding_irprog.get_irp_n_irgs();
+		graphs = new Pointer[size];
+		Map<Pointer, Integer> numbers = new HashMap<Pointer, Integer>();
+		for (int i = 0; i < size; ++i) {
+			graphs[i] = binding_irprog.get_irp_irg(i);
+			numbers.put(graphs[i], i);
+		}
+
+		/* callees */
+		calleeStart = new int[size + 1];
+		int[] calleeList = new int[Math.max(size, 16)];
+		int n = 0;
+		int[] nCallers = new int[size];
+		for (int i = 0; i < size; ++i) {
+			calleeStart[i] = n;
+			int nCallees = binding_callgraph.get_irg_n_callees(graphs[i]);
+			for (int c = 0; c < nCallees; ++c) {
+				Integer callee = numbers.get(binding_callgraph.get_irg_callee(graphs[i], c));
+				if (callee == null)
+					continue;
+				if (n == calleeList.length)
+					calleeList = Arrays.copyOf(calleeList, n * 2);
+				calleeList[n++] = callee;
+				++nCallers[callee];
+			}
+		}
+		calleeStart[size] = n;
+		callees = Arrays.copyOf(calleeList, n);
+
+		/* callers are the inverted callee lists */
+		callerStart = new int[size + 1];
+		for (int i = 0; i < size; ++i) {
+			callerStart[i + 1] = callerStart[i] + nCallers[i];
+		}
+		callers = new int[n];
+		int[] fill = Arrays.copyOf(callerStart, size);
+		for (int i = 0; i < size; ++i) {
+			for (int c = calleeStart[i]; c < calleeStart[i + 1]; ++c) {
+				callers[fill[callees[c]]++] = i;
+			}
+		}
+
+		/* strongly connected components */
+		sccOf = new int[size];
+		sccMembers = new int[size];
+		int[] starts = new int[size + 1];
+		nSccs = computeSccs(starts);
+		sccStart = Arrays.copyOf(starts, nSccs + 1);
+
+		sccLevel = new int[nSccs];
+		for (int scc = 0; scc < nSccs; ++scc) {
+			int level = 0;
+			for (int m = sccStart[scc]; m < sccStart[scc + 1]; ++m) {
+				int g = sccMembers[m];
+				for (int c = calleeStart[g]; c < calleeStart[g + 1]; ++c) {
+					int calleeScc = sccOf[callees[c]];
+					if (calleeScc != scc)
+						level = Math.max(level, sccLevel[calleeScc] + 1);
+				}
+			}
+			sccLevel[scc] = level;
+		}
+	}
+
+	/**
+	 * Tarjan's algorithm with an explicit stack. Components are completed
+	 * callees first, so they are numbered bottom-up.
+	 */
+	private int computeSccs(int[] starts) {
+		int[] index = new int[size];
+		int[] lowlink = new int[size];
+		boolean[] onStack = new boolean[size];
+		Arrays.fill(index, -1);
+		int[] stack = new int[size];
+		int sp = 0;
+		int[] callStack = new int[size];
+		int[] nextEdge = new int[size];
+		int csp = 0;
+		int nextIndex = 0;
+		int nComponents = 0;
+		int nMembers = 0;
+
+		for (int root = 0; root < size; ++root) {
+			if (index[root] >= 0)
+				continue;
+			callStack[csp] = root;
+			nextEdge[csp] = calleeStart[root];
+			++csp;
+			index[root] = lowlink[root] = nextIndex++;
+			stack[sp++] = root;
+			onStack[root] = true;
+
+			while (csp > 0) {
+				int g = callStack[csp - 1];
+				if (nextEdge[csp - 1] < calleeStart[g + 1]) {
+					int callee = callees[nextEdge[csp - 1]++];
+					if (index[callee] < 0) {
+						index[callee] = lowlink[callee] = nextIndex++;
+						stack[sp++] = callee;
+						onStack[callee] = true;
+						callStack[csp] = callee;
+						nextEdge[csp] = calleeStart[callee];
+						++csp;
+					} else if (onStack[callee]) {
+						lowlink[g] = Math.min(lowlink[g], index[callee]);
+					}
+					continue;
+				}
+
+				/* all callees of g done */
+				--csp;
+				if (csp > 0) {
+					int parent = callStack[csp - 1];
+					lowlink[parent] = Math.min(lowlink[parent], lowlink[g]);
+				}
+				if (lowlink[g] == index[g]) {
+					starts[nComponents] = nMembers;
+					int member;
+					do {
+						member = stack[--sp];
+						onStack[member] = false;
+						sccOf[member] = nComponents;
+						sccMembers[nMembers++] = member;
+					} while (member != g);
+					++nComponents;
+				}
+			}
+		}
+		starts[nComponents] = nMembers;
+		return nComponents;
+	}
+
+	/** returns the number of a graph or -1 if it is not part of the program */
+	public int getGraphNr(Graph graph) {
+		for (int i = 0; i < size; ++i) {
+			if (graphs[i].equals(graph.ptr))
+				return i;
+		}
+		return -1;
+	}
+
+	/** returns the graph with the given number */
+	public Graph getGraph(int nr) {
+		return new Graph(graphs[nr]);
+	}
+
+	/** returns the graphs called by a graph */
+	public Graph[] getCallees(int nr) {
+		return getGraphs(callees, calleeStart[nr], calleeStart[nr + 1]);
+	}
+
+	/** returns the graphs calling a graph */
+	public Graph[] getCallers(int nr) {
+		return getGraphs(callers, callerStart[nr], callerStart[nr + 1]);
+	}
+
+	/** returns the graphs of a strongly connected component */
+	public Graph[] getScc(int scc) {
+		return getGraphs(sccMembers, sccStart[scc], sccStart[scc + 1]);
+	}
+
+	/**
+	 * returns all graphs in bottom-up order: callees come before their
+	 * callers (except for recursive calls inside a component)
+	 */
+	public Graph[] getBottomUpOrder() {
+		return getGraphs(sccMembers, 0, size);
+	}
+
+	/** returns true if a graph is (directly or indirectly) recursive */
+	public boolean isRecursive(int nr) {
+		int scc = sccOf[nr];
+		if (sccStart[scc + 1] - sccStart[scc] > 1)
+			return true;
+		for (int c = calleeStart[nr]; c < calleeStart[nr + 1]; ++c) {
+			if (callees[c] == nr)
+				return true;
+		}
+		return false;
+	}
+
+	private Graph[] getGraphs(int[] list, int begin, int end) {
+		Graph[] result = new Graph[end - begin];
+		for (int i = begin; i < end; ++i) {
+			result[i - begin] = new Graph(graphs[list[i]]);
+		}
+		return result;
+	}
+}
@@ -17,7 +17,7 @@ public class ClassType extends Type {
 	}
 	
 	public ClassType(String name) {
-		this(new Ident(name));
+		this(Ident.intern(name));
 	}
 	
 	public Ident getIdent() {
@@ -66,7 +66,7 @@ public class ClassType extends Type {
 	}
 	
 	public Entity getMemberByName(String name) {
-		return getMemberByName(new Ident(name));
+		return getMemberByName(Ident.intern(name));
 	}
 
 	public void addSubtype(Type subType) {
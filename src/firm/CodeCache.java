@@ -0,0 +1,328 @@
+package firm;
+
+import java.io.BufferedReader;
+import java.io.BufferedWriter;
+import java.io.File;
+import java.io.FileReader;
+import java.io.FileWriter;
+import java.io.IOException;
+import java.io.PrintStream;
+import java.util.ArrayList;
+import java.util.HashMap;
+import java.util.HashSet;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.Set;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import com.sun.jna.Pointer;
+
+import firm.bindings.binding_be;
+import firm.bindings.binding_irgraph;
+import firm.bindings.binding_iroptimize;
+import firm.bindings.binding_irprog;
+import firm.bindings.binding_libc;
+import firm.bindings.binding_typerep;
+
+/**
+ * An on-disk cache from the structural hash of a graph (see StructuralHash)
+ * to the assembler code the backend emitted for it.
+ *
+ * createAssembler() looks up every graph of the program. Graphs found in
+ * the cache are removed from the program before the backend runs, so
+ * neither optimize_cf nor the code generation is done for them; their
+ * cached code is appended to the output afterwards. The code for the other
+ * graphs is cut out of the backend output (between the "# -- Begin" and
+ * "# -- End" lines the assembler emitter writes around each function) and
+ * stored in the cache.
+ *
+ * While the backend runs, the cached graphs are taken out of the program
+ * and their entities are made external declarations. Afterwards the graphs
+ * and visibilities are restored (the graphs are appended to the end of the
+ * program's graph list). The graphs compiled by the backend are changed by
+ * it just like with Backend.createAssembler().
+ *
+ * Functions referencing local labels outside of their own code or entities
+ * the backend created (like floating point constants) are not cached,
+ * because these would not exist in a later output file.
+ */
+public class CodeCache {
+
+	private static final String BEGIN = "# -- Begin  ";
+	private static final String END = "# -- End  ";
+	/** local labels (.L... at the start of a token) */
+	private static final Pattern LOCAL_LABEL = Pattern.compile("(?<![\\w.$])\\.L(\\w+)");
+	/** directives with string data, which must not be changed */
+	private static final Pattern STRING_DIRECTIVE = Pattern.compile("^\\s*\\.(ascii|asciz|string)\\b");
+	private static final Pattern LOCAL_LABEL_DEF = Pattern.compile("^\\s*(\\.L\\w+):");
+
+	private final File directory;
+	private final String configuration;
+
+	private int hits;
+	private int misses;
+	private int stored;
+	private int uncacheable;
+
+	/**
+	 * creates a cache
+	 * @param directory      directory containing the cache files (created
+	 *                       if it does not exist)
+	 * @param configuration  everything besides the graph influencing the
+	 *                       generated code, like the backend options used.
+	 *                       It is part of the hash.
+	 */
+	public CodeCache(File directory, String configuration) {
+		this.directory = directory;
+		this.configuration = configuration;
+	}
+
+	/** returns the cache file for a hash */
+	private File getFile(String hash) {
+		return new File(directory, hash + ".s");
+	}
+
+	/**
+	 * like Backend.createAssembler() but takes the code of unchanged
+	 * functions from the cache (and stores the code of the others)
+	 */
+	public void createAssembler(String outputFileName, String compilationUnitName) throws IOException {
+		if (!directory.isDirectory() && !directory.mkdirs())
+			throw new IOException("Couldn't create cache directory: " + directory);
+
+		/* look up all graphs first, removing graphs changes the graph list */
+		Map<String, String> missing = new HashMap<String, String>();
+		Map<String, String> cachedCode = new LinkedHashMap<String, String>();
+		List<Graph> cachedGraphs = new ArrayList<Graph>();
+		for (Graph graph : Program.getGraphs()) {
+			String ldName = graph.getEntity().getLdName();
+			String hash = StructuralHash.compute(graph, configuration);
+			File file = getFile(hash);
+			if (file.isFile()) {
+				cachedCode.put(ldName, readFile(file));
+				cachedGraphs.add(graph);
+				++hits;
+			} else {
+				missing.put(ldName, hash);
+				++misses;
+			}
+		}
+
+		/*
+		 * cached functions are only declared in the new output: take their
+		 * graphs out of the program while the backend runs
+		 */
+		int[] visibilities = new int[cachedGraphs.size()];
+		for (int i = 0; i < cachedGraphs.size(); ++i) {
+			Graph graph = cachedGraphs.get(i);
+			Pointer entity = graph.getEntity().ptr;
+			visibilities[i] = binding_typerep.get_entity_visibility(entity);
+			binding_irprog.remove_irp_irg_from_list(graph.ptr);
+			binding_typerep.set_entity_irg(entity, Pointer.NULL);
+			binding_typerep.set_entity_visibility(entity, Entity.ir_visibility.ir_visibility_external.val);
+		}
+
+		File backendOutput = null;
+		try {
+			Set<String> entitiesBefore = getGlobalEntityNames();
+			backendOutput = File.createTempFile("jfirm-cache", ".s");
+			Pointer file = binding_libc.fopen(backendOutput.getPath(), "w");
+			if (file == null) {
+				throw new IOException("Couldn't open output file (write access): " + backendOutput);
+			}
+			for (Graph graph : Program.getGraphs()) {
+				binding_iroptimize.optimize_cf(graph.ptr);
+			}
+			binding_be.be_main(file, compilationUnitName);
+			binding_libc.fclose(file);
+
+			Set<String> backendEntities = getGlobalEntityNames();
+			backendEntities.removeAll(entitiesBefore);
+
+			String output = readFile(backendOutput);
+			storeFunctions(output, missing, backendEntities);
+			writeOutput(outputFileName, output, cachedCode.values());
+		} finally {
+			if (backendOutput != null)
+				backendOutput.delete();
+			/* put the cached graphs back */
+			for (int i = 0; i < cachedGraphs.size(); ++i) {
+				Graph graph = cachedGraphs.get(i);
+				Pointer entity = binding_irgraph.get_irg_entity(graph.ptr);
+				binding_typerep.set_entity_irg(entity, graph.ptr);
+				binding_typerep.set_entity_visibility(entity, visibilities[i]);
+				binding_irprog.add_irp_irg(graph.ptr);
+			}
+		}
+	}
+
+	/** returns the ld names of all members of the global type */
+	private static Set<String> getGlobalEntityNames() {
+		Set<String> names = new HashSet<String>();
+		for (Entity entity : Program.getGlobalType().getMembers()) {
+			names.add(entity.getLdName());
+		}
+		return names;
+	}
+
+	/** cuts the code of the missing functions out of the backend output */
+	private void storeFunctions(String output, Map<String, String> missing, Set<String> backendEntities)
+			throws IOException {
+		int pos = 0;
+		while ((pos = output.indexOf(BEGIN, pos)) >= 0) {
+			int nameEnd = output.indexOf('\n', pos);
+			if (nameEnd < 0)
+				break;
+			String name = output.substring(pos + BEGIN.length(), nameEnd).trim();
+			String endLine = END + name;
+			int end = output.indexOf(endLine, nameEnd);
+			if (end < 0)
+				break;
+			end = output.indexOf('\n', end);
+			end = end < 0 ? output.length() : end + 1;
+			String code = output.substring(pos, end);
+			pos = end;
+
+			String hash = missing.get(name);
+			/* platforms prefixing symbols with an underscore */
+			if (hash == null && name.startsWith("_"))
+				hash = missing.get(name.substring(1));
+			if (hash == null)
+				continue;
+
+			if (!isSelfContained(code, backendEntities)) {
+				++uncacheable;
+				continue;
+			}
+			File file = getFile(hash);
+			File temp = new File(directory, hash + ".tmp");
+			writeFile(temp, code);
+			if (!temp.renameTo(file)) {
+				temp.delete();
+				continue;
+			}
+			++stored;
+		}
+	}
+
+	/**
+	 * checks that the code only references local labels it defines itself
+	 * and none of the entities created by the backend
+	 */
+	private static boolean isSelfContained(String code, Set<String> backendEntities) {
+		Set<String> defined = new HashSet<String>();
+		for (String line : code.split("\n")) {
+			Matcher matcher = LOCAL_LABEL_DEF.matcher(line);
+			if (matcher.find())
+				defined.add(matcher.group(1));
+		}
+		for (String line : code.split("\n")) {
+			if (STRING_DIRECTIVE.matcher(line).find())
+				continue;
+			Matcher matcher = LOCAL_LABEL.matcher(line);
+			while (matcher.find()) {
+				if (!defined.contains(matcher.group()))
+					return false;
+			}
+		}
+		for (String name : backendEntities) {
+			if (Pattern.compile("(?<![\\w.$])" + Pattern.quote(name) + "(?![\\w.$])").matcher(code).find())
+				return false;
+		}
+		return true;
+	}
+
+	/**
+	 * writes the backend output followed by the cached functions. Local
+	 * labels of the cached functions get a unique prefix, they could clash
+	 * with the labels of the backend output.
+	 */
+	private void writeOutput(String outputFileName, String output, Iterable<String> cached) throws IOException {
+		BufferedWriter out = new BufferedWriter(new FileWriter(outputFileName));
+		try {
+			out.write(output);
+			int n = 0;
+			for (String code : cached) {
+				String prefix = ".Lcc" + n++ + "_";
+				out.write("\t.text\n");
+				for (String line : code.split("\n")) {
+					if (!STRING_DIRECTIVE.matcher(line).find())
+						line = LOCAL_LABEL.matcher(line).replaceAll(Matcher.quoteReplacement(prefix) + "$1");
+					out.write(line);
+					out.write('\n');
+				}
+			}
+		} finally {
+			out.close();
+		}
+	}
+
+	private static String readFile(File file) throws IOException {
+		StringBuilder result = new StringBuilder();
+		BufferedReader in = new BufferedReader(new FileReader(file));
+		try {
+			char[] buffer = new char[8192];
+			int n;
+			while ((n = in.read(buffer)) > 0) {
+				result.append(buffer, 0, n);
+			}
+		} finally {
+			in.close();
+		}
+		return result.toString();
+	}
+
+	private static void writeFile(File file, String contents) throws IOException {
+		BufferedWriter out = new BufferedWriter(new FileWriter(file));
+		try {
+			out.write(contents);
+		} finally {
+			out.close();
+		}
+	}
+
+	/** returns the number of functions taken from the cache */
+	public int getHits() {
+		return hits;
+	}
+
+	/** returns the number of functions compiled by the backend */
+	public int getMisses() {
+		return misses;
+	}
+
+	/** returns the number of functions stored in the cache */
+	public int getStored() {
+		return stored;
+	}
+
+	/** returns the number of compiled functions which could not be cached */
+	public int getUncacheable() {
+		return uncacheable;
+	}
+
+	/** returns hits / (hits + misses) or 0 if nothing was looked up yet */
+	public double getHitRate() {
+		int lookups = hits + misses;
+		return lookups > 0 ? (double) hits / lookups : 0.0;
+	}
+
+	public void resetStatistics() {
+		hits = 0;
+		misses = 0;
+		stored = 0;
+		uncacheable = 0;
+	}
+
+	/** prints the cache statistics */
+	public void printStatistics(PrintStream out) {
+		out.printf("code cache %s:%n", directory);
+		out.printf("  %-12s %8d%n", "lookups", hits + misses);
+		out.printf("  %-12s %8d (%.1f%%)%n", "hits", hits, 100.0 * getHitRate());
+		out.printf("  %-12s %8d%n", "misses", misses);
+		out.printf("  %-12s %8d%n", "stored", stored);
+		out.printf("  %-12s %8d%n", "uncacheable", uncacheable);
+	}
+}
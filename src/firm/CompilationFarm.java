@@ -0,0 +1,343 @@
+package firm;
+
+import java.io.BufferedReader;
+import java.io.BufferedWriter;
+import java.io.File;
+import java.io.FileReader;
+import java.io.FileWriter;
+import java.io.IOException;
+import java.io.InputStream;
+import java.io.InputStreamReader;
+import java.io.PrintStream;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.HashSet;
+import java.util.List;
+import java.util.Set;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+/**
+ * Compiles the functions of a compilation unit in several worker processes.
+ *
+ * libFirm keeps global state (the current program, the current graph, the
+ * construction flag), so a single JVM can only compile on one core. The farm
+ * splits the functions of a compilation unit into partitions and starts a
+ * worker JVM for each. Every worker runs Firm.init(), lets the frontend
+ * build the functions of its partition, and writes them with
+ * Backend.createAssembler(). The outputs are then merged into a single
+ * assembler file, or assembled into one object file per worker.
+ *
+ * The frontend is instantiated by name in the workers, so it needs a
+ * public constructor without arguments. When building a partition it must
+ * define only the functions of that partition and declare all other
+ * functions. Global data must be defined in exactly one partition, for
+ * example in partition 0. Each worker sets a different
+ * Ident.setUniquePrefix(), so names from Ident.createUnique() don't clash.
+ */
+public class CompilationFarm {
+
+	/** the frontend interface used by the farm */
+	public interface Frontend {
+		/**
+		 * returns the names of all functions of the compilation unit. This
+		 * is called in the driver process (without Firm.init()).
+		 */
+		String[] getFunctions(String[] args) throws Exception;
+
+		/**
+		 * builds the firm graphs of the functions of one partition. This is
+		 * called in a worker process after Firm.init().
+		 * @param args       the arguments passed to CompilationFarm.compile
+		 * @param partition  the number of the partition (0 .. nPartitions-1)
+		 * @param functions  names of the functions to define
+		 */
+		void build(String[] args, int partition, Set<String> functions) throws Exception;
+	}
+
+	/** how the outputs of the workers are combined */
+	public static enum OutputMode {
+		/** a single assembler file (local labels are renamed per worker) */
+		SINGLE_ASSEMBLER_FILE,
+		/** one object file per worker, assembled with the assembler command */
+		OBJECT_FILES
+	}
+
+	private final Class<? extends Frontend> frontend;
+	private final int nWorkers;
+	private String compilationUnitName = "<builtin>";
+	private String assembler = "gcc";
+	private final List<String> jvmOptions = new ArrayList<String>();
+
+	/**
+	 * creates a farm
+	 * @param frontend  frontend class, instantiated in every worker
+	 * @param nWorkers  number of worker processes (at least 1)
+	 */
+	public CompilationFarm(Class<? extends Frontend> frontend, int nWorkers) {
+		if (nWorkers < 1)
+			throw new IllegalArgumentException("need at least one worker");
+		this.frontend = frontend;
+		this.nWorkers = nWorkers;
+		String libraryPath = System.getProperty("jna.library.path");
+		if (libraryPath != null)
+			jvmOptions.add("-Djna.library.path=" + libraryPath);
+	}
+
+	/** sets the compilation unit name passed to the backend */
+	public void setCompilationUnitName(String name) {
+		compilationUnitName = name;
+	}
+
+	/** sets the command used to assemble object files (default gcc) */
+	public void setAssembler(String assembler) {
+		this.assembler = assembler;
+	}
+
+	/** adds an option for the worker JVMs (like -Xmx512m) */
+	public void addJvmOption(String option) {
+		jvmOptions.add(option);
+	}
+
+	/**
+	 * distributes the functions round-robin over the workers, returns one
+	 * set of function names per non-empty partition
+	 */
+	public List<Set<String>> partition(String[] functions) {
+		int n = Math.min(nWorkers, Math.max(functions.length, 1));
+		List<Set<String>> partitions = new ArrayList<Set<String>>(n);
+		for (int i = 0; i < n; ++i) {
+			partitions.add(new HashSet<String>());
+		}
+		for (int i = 0; i < functions.length; ++i) {
+			partitions.get(i % n).add(functions[i]);
+		}
+		return partitions;
+	}
+
+	/**
+	 * compiles the compilation unit
+	 * @param args    arguments for the frontend
+	 * @param output  the assembler file (SINGLE_ASSEMBLER_FILE) or the
+	 *                directory for the object files (OBJECT_FILES)
+	 * @param mode    how to combine the worker outputs
+	 * @return the produced files
+	 */
+	public File[] compile(String[] args, File output, OutputMode mode) throws IOException {
+		String[] functions;
+		try {
+			functions = frontend.newInstance().getFunctions(args);
+		} catch (IOException e) {
+			throw e;
+		} catch (Exception e) {
+			throw new IOException("frontend failed", e);
+		}
+		List<Set<String>> partitions = partition(functions);
+
+		File tempDir = createTempDir();
+		try {
+			File[] parts = new File[partitions.size()];
+			Process[] workers = new Process[partitions.size()];
+			Thread[] pumps = new Thread[partitions.size()];
+			for (int i = 0; i < partitions.size(); ++i) {
+				File functionList = new File(tempDir, "part" + i + ".functions");
+				writeLines(functionList, partitions.get(i));
+				parts[i] = new File(tempDir, "part" + i + ".s");
+				workers[i] = startWorker(i, functionList, parts[i], args);
+				pumps[i] = pump(workers[i].getInputStream(), System.err, "[worker " + i + "] ");
+			}
+			waitFor(workers, pumps);
+
+			if (mode == OutputMode.SINGLE_ASSEMBLER_FILE) {
+				mergeAssembler(parts, output);
+				return new File[] { output };
+			}
+
+			if (!output.isDirectory() && !output.mkdirs())
+				throw new IOException("Couldn't create output directory: " + output);
+			File[] objects = new File[parts.length];
+			for (int i = 0; i < parts.length; ++i) {
+				objects[i] = new File(output, "part" + i + ".o");
+				assemble(parts[i], objects[i]);
+			}
+			return objects;
+		} finally {
+			deleteRecursive(tempDir);
+		}
+	}
+
+	private Process startWorker(int partition, File functionList, File output, String[] args) throws IOException {
+		List<String> command = new ArrayList<String>();
+		command.add(System.getProperty("java.home") + File.separator + "bin" + File.separator + "java");
+		command.addAll(jvmOptions);
+		command.add("-cp");
+		command.add(System.getProperty("java.class.path"));
+		command.add(CompilationFarm.class.getName());
+		command.add(frontend.getName());
+		command.add(Integer.toString(partition));
+		command.add(functionList.getPath());
+		command.add(output.getPath());
+		command.add(compilationUnitName);
+		command.addAll(Arrays.asList(args));
+
+		ProcessBuilder builder = new ProcessBuilder(command);
+		builder.redirectErrorStream(true);
+		return builder.start();
+	}
+
+	private static void waitFor(Process[] workers, Thread[] pumps) throws IOException {
+		List<Integer> failed = new ArrayList<Integer>();
+		for (int i = 0; i < workers.length; ++i) {
+			try {
+				if (workers[i].waitFor() != 0)
+					failed.add(i);
+				pumps[i].join();
+			} catch (InterruptedException e) {
+				for (Process worker : workers) {
+					worker.destroy();
+				}
+				Thread.currentThread().interrupt();
+				throw new IOException("interrupted while waiting for workers");
+			}
+		}
+		if (!failed.isEmpty())
+			throw new IOException("compilation failed in worker(s) " + failed);
+	}
+
+	/** local labels of the ELF assembler syntax (.L... at the start of a token) */
+	private static final Pattern LOCAL_LABEL = Pattern.compile("(?<![\\w.$])\\.L(\\w+)");
+
+	/** directives with string data, which must not be changed */
+	private static final Pattern STRING_DIRECTIVE = Pattern.compile("^\\s*\\.(ascii|asciz|string)\\b");
+
+	/**
+	 * concatenates the assembler files of the workers. Local labels are
+	 * only unique per file, so they get a per-worker prefix.
+	 */
+	private static void mergeAssembler(File[] parts, File output) throws IOException {
+		BufferedWriter out = new BufferedWriter(new FileWriter(output));
+		try {
+			for (int i = 0; i < parts.length; ++i) {
+				String prefix = ".Lw" + i + "_";
+				BufferedReader in = new BufferedReader(new FileReader(parts[i]));
+				try {
+					String line;
+					while ((line = in.readLine()) != null) {
+						if (STRING_DIRECTIVE.matcher(line).find()) {
+							out.write(line);
+						} else {
+							Matcher matcher = LOCAL_LABEL.matcher(line);
+							out.write(matcher.replaceAll(Matcher.quoteReplacement(prefix) + "$1"));
+						}
+						out.newLine();
+					}
+				} finally {
+					in.close();
+				}
+			}
+		} finally {
+			out.close();
+		}
+	}
+
+	private void assemble(File source, File object) throws IOException {
+		ProcessBuilder builder = new ProcessBuilder(assembler, "-c", source.getPath(), "-o", object.getPath());
+		builder.redirectErrorStream(true);
+		Process process = builder.start();
+		Thread pump = pump(process.getInputStream(), System.err, "[" + assembler + "] ");
+		waitFor(new Process[] { process }, new Thread[] { pump });
+	}
+
+	/** copies the output of a process to out, prefixing every line */
+	private static Thread pump(final InputStream in, final PrintStream out, final String prefix) {
+		Thread thread = new Thread() {
+			@Override
+			public void run() {
+				BufferedReader reader = new BufferedReader(new InputStreamReader(in));
+				try {
+					String line;
+					while ((line = reader.readLine()) != null) {
+						out.println(prefix + line);
+					}
+				} catch (IOException e) {
+					/* process ended */
+				}
+			}
+		};
+		thread.setDaemon(true);
+		thread.start();
+		return thread;
+	}
+
+	private static File createTempDir() throws IOException {
+		File dir = File.createTempFile("jfirm-farm", "");
+		if (!dir.delete() || !dir.mkdir())
+			throw new IOException("Couldn't create temporary directory: " + dir);
+		return dir;
+	}
+
+	private static void deleteRecursive(File file) {
+		File[] children = file.listFiles();
+		if (children != null) {
+			for (File child : children) {
+				deleteRecursive(child);
+			}
+		}
+		file.delete();
+	}
+
+	private static void writeLines(File file, Set<String> lines) throws IOException {
+		BufferedWriter out = new BufferedWriter(new FileWriter(file));
+		try {
+			for (String line : lines) {
+				out.write(line);
+				out.newLine();
+			}
+		} finally {
+			out.close();
+		}
+	}
+
+	private static Set<String> readLines(File file) throws IOException {
+		Set<String> lines = new HashSet<String>();
+		BufferedReader in = new BufferedReader(new FileReader(file));
+		try {
+			String line;
+			while ((line = in.readLine()) != null) {
+				if (line.length() > 0)
+					lines.add(line);
+			}
+		} finally {
+			in.close();
+		}
+		return lines;
+	}
+
+	/**
+	 * entry point of the worker processes:
+	 * frontend-class partition function-list output-file unit-name args...
+	 */
+	public static void main(String[] args) {
+		if (args.length < 5) {
+			System.err.println("usage: CompilationFarm frontend partition functions output unitname [args...]");
+			System.exit(2);
+		}
+		try {
+			Frontend frontend = (Frontend) Class.forName(args[0]).newInstance();
+			int partition = Integer.parseInt(args[1]);
+			Set<String> functions = readLines(new File(args[2]));
+			String[] frontendArgs = Arrays.copyOfRange(args, 5, args.length);
+
+			Firm.init();
+			/* unique names of different workers must not clash */
+			Ident.setUniquePrefix("w" + partition + "_");
+			frontend.build(frontendArgs, partition, functions);
+			Backend.createAssembler(args[3], args[4]);
+			Firm.finish();
+		} catch (Throwable t) {
+			t.printStackTrace();
+			System.exit(1);
+		}
+		System.exit(0);
+	}
+}
@@ -46,7 +46,7 @@ public class Construction extends ConstructionBase {
 	}
 	
 	public Block newBlock() {
-		return new Block(binding_ircons.new_immBlock());
+		return (Block) Node.createWrapper(binding_ircons.new_immBlock());
 	}
 	
 	public Node newSymConst(Entity entity) {
@@ -58,7 +58,7 @@ public class Construction extends ConstructionBase {
 	}
 	
 	public Node newConst(int value, Mode mode) {
-		return newConst(new TargetValue(value, mode));
+		return newConst(TargetValue.fromLong(value, mode));
 	}
 	
 	public Node newLoad(Node mem, Node ptr, Mode loadMode) {
@@ -96,7 +96,7 @@ public class Construction extends ConstructionBase {
 		Pointer ptr = binding_ircons.get_cur_block();
 		if (ptr == null)
 			return null;
-		return new Block(binding_ircons.get_cur_block());
+		return (Block) Node.createWrapper(binding_ircons.get_cur_block());
 	}
 
 	/**
@@ -0,0 +1,113 @@
+package firm;
+
+import java.io.Closeable;
+import java.util.ArrayList;
+import java.util.List;
+
+import com.sun.jna.Pointer;
+
+import firm.bindings.binding_cdep;
+import firm.nodes.Block;
+import firm.nodes.Node;
+
+/**
+ * The control dependences between the blocks of a graph (cdep.h).
+ * libfirm keeps only one set of control dependence data for the whole
+ * program: computing the control dependences of any graph frees the data
+ * computed before. So only the most recently created ControlDependence
+ * object is usable, queries on older objects throw an
+ * IllegalStateException. The native data must be released with close().
+ */
+public class ControlDependence implements Closeable {
+
+	/** the graph */
+	public final Graph graph;
+
+	/** the object owning the global native data (null if none) */
+	private static ControlDependence owner;
+
+	private boolean closed;
+
+	/**
+	 * computes the control dependences of a graph. This invalidates any
+	 * other ControlDependence object.
+	 */
+	public ControlDependence(Graph graph) {
+		this.graph = graph;
+		binding_cdep.compute_cdep(graph.ptr);
+		owner = this;
+	}
+
+	private void checkOpen() {
+		if (closed)
+			throw new IllegalStateException("ControlDependence already closed");
+		if (owner != this)
+			throw new IllegalStateException("ControlDependence invalidated by a newer ControlDependence");
+	}
+
+	/** returns the blocks a block is (directly) control dependent on */
+	public Block[] getDependences(Block block) {
+		checkOpen();
+		List<Block> result = new ArrayList<Block>();
+		for (Pointer cdep = binding_cdep.find_cdep(block.ptr); cdep != null;
+				cdep = cdep.getPointer(Pointer.SIZE)) {
+			result.add((Block) Node.createWrapper(cdep.getPointer(0)));
+		}
+		return result.toArray(new Block[result.size()]);
+	}
+
+	/** returns true if dependee is directly control dependent on candidate */
+	public boolean isCdepOn(Block dependee, Block candidate) {
+		checkOpen();
+		return binding_cdep.is_cdep_on(dependee.ptr, candidate.ptr) != 0;
+	}
+
+	/**
+	 * returns true if dependee is (possibly iterated) control dependent on
+	 * candidate
+	 */
+	public boolean isIteratedCdepOn(Block dependee, Block candidate) {
+		checkOpen();
+		return binding_cdep.is_iterated_cdep_on(dependee.ptr, candidate.ptr) != 0;
+	}
+
+	/**
+	 * returns the block a block is control dependent on if there is exactly
+	 * one, null otherwise
+	 */
+	public Block getUniqueCdep(Block block) {
+		checkOpen();
+		Pointer result = binding_cdep.get_unique_cdep(block.ptr);
+		return result == null ? null : (Block) Node.createWrapper(result);
+	}
+
+	/** returns true if a block is control dependent on more than one block */
+	public boolean hasMultipleCdep(Block block) {
+		checkOpen();
+		return binding_cdep.has_multiple_cdep(block.ptr) != 0;
+	}
+
+	/**
+	 * replaces the control dependences of block old by the ones of block
+	 * nw (call this when replacing a block)
+	 */
+	public void exchange(Block old, Block nw) {
+		checkOpen();
+		binding_cdep.exchange_cdep(old.ptr, nw.ptr);
+	}
+
+	/**
+	 * releases the native data (free_cdep) if this object still owns it,
+	 * further calls are not allowed
+	 */
+	@Override
+	public void close() {
+		if (closed)
+			return;
+		if (owner == this) {
+			binding_cdep.free_cdep(graph.ptr);
+			owner = null;
+		}
+		closed = true;
+	}
+}
@@ -0,0 +1,151 @@
+package firm;
+
+import java.util.Arrays;
+
+import com.sun.jna.Pointer;
+
+import firm.bindings.binding_irdom;
+import firm.bindings.binding_irnode;
+import firm.nodes.Block;
+
+/**
+ * The (post)dominator tree of a graph, computed by libfirm (irdom) and
+ * exported into int arrays indexed by block idx (see Node.getIdx()).
+ *
+ * Every block gets a number in a preorder walk of the tree, the blocks
+ * dominated by a block b are exactly those with a number between
+ * preNum[b] and maxSubtreePreNum[b]. So dominates() is an interval check
+ * without a native call.
+ * Blocks not reachable from the start block (the end block for
+ * postdominators) are not part of the tree and have preNum -1.
+ * The arrays are a snapshot like GraphView.
+ */
+public final class DominatorTree {
+
+	/** the graph */
+	public final Graph graph;
+
+	/** true if this is the postdominator tree */
+	public final boolean post;
+
+	/** number of node indices (see GraphView.size) */
+	public final int size;
+
+	/** preorder number of the blocks in the tree, -1 for other nodes */
+	public final int[] preNum;
+
+	/** biggest preorder number in the subtree of the blocks */
+	public final int[] maxSubtreePreNum;
+
+	/** idx of the immediate (post)dominator of the blocks or -1 */
+	public final int[] idom;
+
+	/** depth of the blocks in the tree or -1 */
+	public final int[] depth;
+
+	private final NodeIndex blocks;
+
+	DominatorTree(Graph graph, boolean post) {
+		this.graph = graph;
+		this.post = post;
+
+		if (post) {
+			binding_irdom.assure_postdoms(graph.ptr);
+		} else {
+			binding_irdom.assure_doms(graph.ptr);
+		}
+
+		blocks = NodeIndex.collectBlocks(graph);
+		size = blocks.size;
+		preNum = new int[size];
+		maxSubtreePreNum = new int[size];
+		idom = new int[size];
+		depth = new int[size];
+		Arrays.fill(preNum, -1);
+		Arrays.fill(maxSubtreePreNum, -1);
+		Arrays.fill(idom, -1);
+		Arrays.fill(depth, -1);
+
+		for (int idx = 0; idx < size; ++idx) {
+			Pointer block = blocks.get(idx);
+			if (block == null)
+				continue;
+			int d = post ? binding_irdom.get_Block_postdom_depth(block)
+			             : binding_irdom.get_Block_dom_depth(block);
+			if (d < 0)
+				continue;
+			depth[idx] = d;
+
+			Pointer dom;
+			if (post) {
+				preNum[idx] = binding_irdom.get_Block_pdom_tree_pre_num(block);
+				maxSubtreePreNum[idx] = binding_irdom.get_Block_pdom_max_subtree_pre_num(block);
+				dom = binding_irdom.get_Block_ipostdom(block);
+			} else {
+				preNum[idx] = binding_irdom.get_Block_dom_tree_pre_num(block);
+				maxSubtreePreNum[idx] = binding_irdom.get_Block_dom_max_subtree_pre_num(block);
+				dom = binding_irdom.get_Block_idom(block);
+			}
+			if (dom != null)
+				idom[idx] = binding_irnode.get_irn_idx(dom);
+		}
+	}
+
+	/**
+	 * returns true if the block with idx a (post)dominates block b, false
+	 * for blocks which are not part of the tree
+	 */
+	public boolean dominates(int a, int b) {
+		if (!contains(a) || !contains(b))
+			return false;
+		int num = preNum[b];
+		return num >= preNum[a] && num <= maxSubtreePreNum[a];
+	}
+
+	/** returns true if a (post)dominates b and a != b */
+	public boolean strictlyDominates(int a, int b) {
+		return a != b && dominates(a, b);
+	}
+
+	/** returns true if block a (post)dominates block b */
+	public boolean dominates(Block a, Block b) {
+		return dominates(a.getIdx(), b.getIdx());
+	}
+
+	/** returns true if block a (post)dominates block b and a != b */
+	public boolean strictlyDominates(Block a, Block b) {
+		return strictlyDominates(a.getIdx(), b.getIdx());
+	}
+
+	/** returns true if the block is part of the tree */
+	public boolean contains(int idx) {
+		return idx >= 0 && idx < size && preNum[idx] >= 0;
+	}
+
+	/** returns the immediate (post)dominator of a block or null */
+	public Block getIdom(Block block) {
+		int idx = block.getIdx();
+		return contains(idx) ? getBlock(idom[idx]) : null;
+	}
+
+	/** returns the wrapper object for the block with the given idx or null */
+	public Block getBlock(int idx) {
+		return blocks.getBlock(idx);
+	}
+
+	/**
+	 * Walks the (post)dominator tree with the native walker
+	 * (dom_tree_walk_irg/postdom_tree_walk_irg). pre is called before the
+	 * dominated blocks are visited, post afterwards; either may be null.
+	 */
+	public void walk(BlockWalker pre, BlockWalker post) {
+		WalkCallback preCallback = WalkCallback.create(pre);
+		WalkCallback postCallback = WalkCallback.create(post);
+		if (this.post) {
+			binding_irdom.postdom_tree_walk_irg(graph.ptr, preCallback, postCallback, Pointer.NULL);
+		} else {
+			binding_irdom.dom_tree_walk_irg(graph.ptr, preCallback, postCallback, Pointer.NULL);
+		}
+		WalkCallback.rethrow(preCallback, postCallback);
+	}
+}
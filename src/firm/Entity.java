@@ -19,7 +19,7 @@ public class Entity extends JNAWrapper {
 	}
 	
 	public Entity(Type owner, String name, Type type) {
-		this(owner, new Ident(name), type);
+		this(owner, Ident.intern(name), type);
 	}
 	
 	public final void free() {
@@ -55,7 +55,7 @@ public class Entity extends JNAWrapper {
 	}
 	
 	public final void setLdIdent(String ldIdent) {
-		setLdIdent(new Ident(ldIdent));
+		setLdIdent(Ident.intern(ldIdent));
 	}
 
 	public final String getLdName() {
@@ -0,0 +1,287 @@
+package firm;
+
+import java.io.BufferedReader;
+import java.io.File;
+import java.io.FileReader;
+import java.io.IOException;
+import java.io.Reader;
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.Comparator;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+
+import com.sun.jna.Pointer;
+
+import firm.bindings.binding_execfreq;
+import firm.bindings.binding_irgwalk;
+import firm.bindings.binding_irnode;
+import firm.nodes.Block;
+
+/**
+ * Execution frequencies of the blocks of a graph (execfreq.h), either
+ * estimated by libfirm or taken from a profile of an instrumented run.
+ * The frequencies are relative to the start block (which has frequency 1).
+ *
+ * The native data must be released with free().
+ */
+public class ExecFreq extends JNAWrapper {
+
+	/** default loop weight for estimated frequencies */
+	public static final double DEFAULT_LOOP_WEIGHT = 10.0;
+
+	/** the graph */
+	public final Graph graph;
+
+	private boolean freed;
+
+	private ExecFreq(Graph graph, Pointer ptr) {
+		super(ptr);
+		this.graph = graph;
+	}
+
+	/**
+	 * estimates the block frequencies of a graph, loops are assumed to be
+	 * executed loopWeight times per entry
+	 */
+	public static ExecFreq compute(Graph graph, double loopWeight) {
+		return new ExecFreq(graph, binding_execfreq.compute_execfreq(graph.ptr, loopWeight));
+	}
+
+	/** estimates the block frequencies with the default loop weight */
+	public static ExecFreq compute(Graph graph) {
+		return compute(graph, DEFAULT_LOOP_WEIGHT);
+	}
+
+	/** creates an empty frequency table, fill it with setFreq() */
+	public static ExecFreq create(Graph graph) {
+		return new ExecFreq(graph, binding_execfreq.create_execfreq(graph.ptr));
+	}
+
+	/**
+	 * creates the frequencies of a graph from the block counts of a profile.
+	 * Blocks are identified by their idx (see Node.getIdx()), the counts are
+	 * scaled so the start block has frequency 1. If the profile contains no
+	 * data for the graph the frequencies are estimated with the default loop
+	 * weight. If the control flow of the graph differs from the one the
+	 * profile was recorded for (see getProfileFingerprint()) an
+	 * IllegalArgumentException is thrown.
+	 */
+	public static ExecFreq fromProfile(Graph graph, Profile profile) {
+		String function = graph.getEntity().getLdName();
+		Map<Integer, Long> counts = profile.getCounts(function);
+		if (counts == null)
+			return compute(graph);
+		String fingerprint = getProfileFingerprint(graph);
+		if (!fingerprint.equals(profile.getFingerprint(function)))
+			throw new IllegalArgumentException("profile of " + function
+					+ " does not match the control flow of the graph");
+
+		final List<Block> blocks = new ArrayList<Block>();
+		graph.nativeWalkBlocks(null, new BlockWalker() {
+			@Override
+			public void visitBlock(Block block) {
+				blocks.add(block);
+			}
+		});
+		long maxCount = 0;
+		for (long count : counts.values()) {
+			maxCount = Math.max(maxCount, count);
+		}
+		Long startCount = counts.get(graph.getStartBlock().getIdx());
+		double scale = startCount != null && startCount > 0 ? startCount : Math.max(maxCount, 1);
+
+		ExecFreq result = create(graph);
+		for (Block block : blocks) {
+			Long count = counts.get(block.getIdx());
+			result.setFreq(block, (count != null ? count : 0) / scale);
+		}
+		return result;
+	}
+
+	/**
+	 * returns a fingerprint of the control flow of a graph: the number of
+	 * blocks and a hash of the block indices and their control flow
+	 * predecessors. jFirm does not instrument code itself; whoever produces
+	 * a profile must record this fingerprint together with the block idxs
+	 * of the graph that was instrumented (see Profile), so a profile is not
+	 * applied to a changed graph.
+	 */
+	public static String getProfileFingerprint(Graph graph) {
+		final List<long[]> blocks = new ArrayList<long[]>();
+		binding_irgwalk.irg_block_walk_graph(graph.ptr, new binding_irgwalk.irg_walk_func() {
+			@Override
+			public void callback(Pointer block, Pointer env) {
+				int n = binding_irnode.get_Block_n_cfgpreds(block);
+				long[] data = new long[n + 1];
+				data[0] = binding_irnode.get_irn_idx(block);
+				for (int i = 0; i < n; ++i) {
+					Pointer pred = binding_irnode.get_Block_cfgpred_block(block, i);
+					data[i + 1] = pred == null ? -1 : binding_irnode.get_irn_idx(pred);
+				}
+				blocks.add(data);
+			}
+		}, null, Pointer.NULL);
+		Collections.sort(blocks, new Comparator<long[]>() {
+			@Override
+			public int compare(long[] a, long[] b) {
+				return a[0] < b[0] ? -1 : (a[0] == b[0] ? 0 : 1);
+			}
+		});
+
+		/* FNV-1a over all numbers */
+		long hash = 0xcbf29ce484222325L;
+		for (long[] data : blocks) {
+			hash = (hash ^ data.length) * 0x100000001b3L;
+			for (long value : data) {
+				hash = (hash ^ value) * 0x100000001b3L;
+			}
+		}
+		return blocks.size() + ":" + Long.toHexString(hash);
+	}
+
+	private void checkNotFreed() {
+		if (freed)
+			throw new IllegalStateException("ExecFreq already freed");
+	}
+
+	public void setFreq(Block block, double freq) {
+		checkNotFreed();
+		binding_execfreq.set_execfreq(ptr, block.ptr, freq);
+	}
+
+	public double getFreq(Block block) {
+		checkNotFreed();
+		return binding_execfreq.get_block_execfreq(ptr, block.ptr);
+	}
+
+	/** returns the frequency of a block scaled to an integer */
+	public long getFreqLong(Block block) {
+		checkNotFreed();
+		return binding_execfreq.get_block_execfreq_ulong(ptr, block.ptr).longValue();
+	}
+
+	/**
+	 * returns the frequencies of all blocks in an array indexed by block idx
+	 * (see Node.getIdx()), other indices contain 0
+	 */
+	public double[] exportFreqs() {
+		checkNotFreed();
+		final double[] freqs = new double[graph.getLastIdx()];
+		binding_irgwalk.irg_block_walk_graph(graph.ptr, new binding_irgwalk.irg_walk_func() {
+			@Override
+			public void callback(Pointer block, Pointer env) {
+				int idx = binding_irnode.get_irn_idx(block);
+				if (idx < freqs.length)
+					freqs[idx] = binding_execfreq.get_block_execfreq(ptr, block);
+			}
+		}, null, Pointer.NULL);
+		return freqs;
+	}
+
+	/** releases the native data */
+	public void free() {
+		if (freed)
+			return;
+		binding_execfreq.free_execfreq(ptr);
+		freed = true;
+	}
+
+	/**
+	 * Block counts of an instrumented run. The profile is produced outside
+	 * of jFirm (by the instrumentation of the user's compiler); this is the
+	 * format it must follow. The profile file is a text file with a
+	 * fingerprint line per function and one line per block:
+	 * <pre>
+	 * function-ld-name fingerprint fingerprint-string
+	 * function-ld-name block-idx count
+	 * </pre>
+	 * The fingerprint is ExecFreq.getProfileFingerprint() of the graph at
+	 * the time of instrumentation, blocks are identified by their idx (see
+	 * Node.getIdx()) in that graph. Empty lines and lines starting
+	 * with '#' are ignored. Counts of repeated entries are added up (so the
+	 * profiles of several runs can simply be concatenated), the fingerprints
+	 * of a function must all be the same.
+	 */
+	public static final class Profile {
+		private final Map<String, Map<Integer, Long>> counts = new HashMap<String, Map<Integer, Long>>();
+		private final Map<String, String> fingerprints = new HashMap<String, String>();
+
+		/** reads a profile file */
+		public static Profile read(File file) throws IOException {
+			Reader reader = new FileReader(file);
+			try {
+				return read(reader);
+			} finally {
+				reader.close();
+			}
+		}
+
+		/** reads a profile in the text format described above */
+		public static Profile read(Reader reader) throws IOException {
+			Profile profile = new Profile();
+			BufferedReader in = new BufferedReader(reader);
+			int lineNr = 0;
+			String line;
+			while ((line = in.readLine()) != null) {
+				++lineNr;
+				line = line.trim();
+				if (line.length() == 0 || line.startsWith("#"))
+					continue;
+				String[] fields = line.split("\\s+");
+				if (fields.length != 3)
+					throw new IOException("Invalid profile line " + lineNr + ": " + line);
+				try {
+					if (fields[1].equals("fingerprint")) {
+						profile.setFingerprint(fields[0], fields[2]);
+					} else {
+						profile.addCount(fields[0], Integer.parseInt(fields[1]), Long.parseLong(fields[2]));
+					}
+				} catch (NumberFormatException e) {
+					throw new IOException("Invalid profile line " + lineNr + ": " + line);
+				} catch (IllegalArgumentException e) {
+					throw new IOException("Invalid profile line " + lineNr + ": " + e.getMessage());
+				}
+			}
+			return profile;
+		}
+
+		/**
+		 * sets the control flow fingerprint of a function (see
+		 * ExecFreq.getProfileFingerprint())
+		 */
+		public void setFingerprint(String function, String fingerprint) {
+			String old = fingerprints.get(function);
+			if (old != null && !old.equals(fingerprint))
+				throw new IllegalArgumentException("different fingerprints for " + function);
+			fingerprints.put(function, fingerprint);
+		}
+
+		/** returns the fingerprint of a function or null if there is none */
+		public String getFingerprint(String function) {
+			return fingerprints.get(function);
+		}
+
+		/** adds count executions of a block (given by its idx) to the profile */
+		public void addCount(String function, int blockIdx, long count) {
+			if (blockIdx < 0 || count < 0)
+				throw new IllegalArgumentException("negative block idx or count");
+			Map<Integer, Long> blockCounts = counts.get(function);
+			if (blockCounts == null) {
+				blockCounts = new HashMap<Integer, Long>();
+				counts.put(function, blockCounts);
+			}
+			Long old = blockCounts.get(blockIdx);
+			blockCounts.put(blockIdx, old == null ? count : old + count);
+		}
+
+		/**
+		 * returns the block counts of a function by block idx or null if the
+		 * profile contains no data for the function
+		 */
+		public Map<Integer, Long> getCounts(String function) {
+			return counts.get(function);
+		}
+	}
+}
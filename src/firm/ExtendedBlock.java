@@ -0,0 +1,52 @@
+package firm;
+
+import com.sun.jna.Pointer;
+
+import firm.bindings.binding_irextbb;
+import firm.nodes.Block;
+import firm.nodes.Node;
+
+/**
+ * An extended basic block: a tree of blocks where every block except the
+ * leader has exactly one control flow predecessor (its parent).
+ */
+public class ExtendedBlock extends JNAWrapper {
+
+	public ExtendedBlock(Pointer ptr) {
+		super(ptr);
+	}
+
+	/** returns the number of blocks in the extended block */
+	public int getNBlocks() {
+		return binding_irextbb.get_extbb_n_blocks(ptr);
+	}
+
+	/** returns the n-th block of the extended block */
+	public Block getBlock(int n) {
+		return (Block) Node.createWrapper(binding_irextbb.get_extbb_block(ptr, n));
+	}
+
+	/** returns all blocks of the extended block */
+	public Block[] getBlocks() {
+		Block[] result = new Block[getNBlocks()];
+		for (int i = 0; i < result.length; ++i) {
+			result[i] = getBlock(i);
+		}
+		return result;
+	}
+
+	/** returns the leader (the only block with several predecessors) */
+	public Block getLeader() {
+		return (Block) Node.createWrapper(binding_irextbb.get_extbb_leader(ptr));
+	}
+
+	/** returns the node number of the leader (for debug output) */
+	public long getNr() {
+		return binding_irextbb.get_extbb_node_nr(ptr).longValue();
+	}
+
+	@Override
+	public String toString() {
+		return "ExtendedBlock " + getNr();
+	}
+}
@@ -0,0 +1,7 @@
+package firm;
+
+public interface ExtendedBlockWalker {
+
+	void visitExtendedBlock(ExtendedBlock block);
+	
+}
@@ -0,0 +1,115 @@
+package firm;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+
+import com.sun.jna.Pointer;
+
+import firm.bindings.binding_irextbb;
+import firm.nodes.Block;
+
+/**
+ * The extended basic blocks of a graph (irextbb.h) exported into int
+ * arrays. The extended blocks are numbered in the order of the native
+ * extended block walker (postorder, the one containing the start block
+ * first). The member blocks of extended block e are
+ * members[memberStart[e]] .. members[memberStart[e+1] - 1] (block idx, see
+ * Node.getIdx()), the leader is always the first member.
+ * The arrays are a snapshot like GraphView.
+ */
+public final class ExtendedBlocks {
+
+	/** the graph */
+	public final Graph graph;
+
+	/** number of node indices (see GraphView.size) */
+	public final int size;
+
+	/** start of the member list of each extended block (length getNExtendedBlocks() + 1) */
+	public final int[] memberStart;
+
+	/** block idx of the members of all extended blocks (see memberStart) */
+	public final int[] members;
+
+	/** number of the extended block of each block, -1 for other nodes */
+	public final int[] extendedBlockOf;
+
+	private final ExtendedBlock[] extbbs;
+	private final NodeIndex blocks;
+
+	/**
+	 * computes the extended blocks, using execution frequencies to decide
+	 * which successor continues an extended block if execFreq is not null
+	 */
+	ExtendedBlocks(Graph graph, ExecFreq execFreq) {
+		this.graph = graph;
+		if (execFreq != null) {
+			binding_irextbb.compute_extbb_execfreqs(graph.ptr, execFreq.ptr);
+		} else {
+			binding_irextbb.compute_extbb(graph.ptr);
+		}
+
+		final List<ExtendedBlock> extbbList = new ArrayList<ExtendedBlock>();
+		graph.walkExtendedBlocks(null, new ExtendedBlockWalker() {
+			@Override
+			public void visitExtendedBlock(ExtendedBlock extbb) {
+				extbbList.add(extbb);
+			}
+		});
+		extbbs = extbbList.toArray(new ExtendedBlock[extbbList.size()]);
+
+		blocks = new NodeIndex(graph);
+		size = blocks.size;
+		extendedBlockOf = new int[size];
+		Arrays.fill(extendedBlockOf, -1);
+		memberStart = new int[extbbs.length + 1];
+		int[] memberList = new int[Math.max(extbbs.length, 16)];
+		int nMembers = 0;
+		for (int e = 0; e < extbbs.length; ++e) {
+			memberStart[e] = nMembers;
+			Pointer extbb = extbbs[e].ptr;
+			Pointer leader = binding_irextbb.get_extbb_leader(extbb);
+			int nBlocks = binding_irextbb.get_extbb_n_blocks(extbb);
+			if (nMembers + nBlocks > memberList.length)
+				memberList = Arrays.copyOf(memberList, Math.max(nMembers + nBlocks, memberList.length * 2));
+
+			memberList[nMembers++] = addBlock(leader, e);
+			for (int i = 0; i < nBlocks; ++i) {
+				Pointer block = binding_irextbb.get_extbb_block(extbb, i);
+				if (block.equals(leader))
+					continue;
+				memberList[nMembers++] = addBlock(block, e);
+			}
+		}
+		memberStart[extbbs.length] = nMembers;
+		members = Arrays.copyOf(memberList, nMembers);
+	}
+
+	private int addBlock(Pointer block, int extbb) {
+		int idx = blocks.add(block);
+		if (idx < size)
+			extendedBlockOf[idx] = extbb;
+		return idx;
+	}
+
+	/** returns the number of extended blocks */
+	public int getNExtendedBlocks() {
+		return extbbs.length;
+	}
+
+	/** returns the number of blocks in an extended block */
+	public int getNMembers(int extbb) {
+		return memberStart[extbb + 1] - memberStart[extbb];
+	}
+
+	/** returns the wrapper object for an extended block */
+	public ExtendedBlock getExtendedBlock(int extbb) {
+		return extbbs[extbb];
+	}
+
+	/** returns the wrapper object for the block with the given idx or null */
+	public Block getBlock(int idx) {
+		return blocks.getBlock(idx);
+	}
+}
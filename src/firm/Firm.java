@@ -9,6 +9,7 @@ import com.sun.jna.Pointer;
 import firm.bindings.binding_firm_common;
 import firm.bindings.binding_irflag;
 import firm.bindings.binding_libc;
+import firm.nodes.NodeCache;
 
 public final class Firm {
 	
@@ -100,6 +101,11 @@ public final class Firm {
 	 * operaion must be performed anymore.
 	 */
 	public static void finish() {
+		Mode.clearCache();
+		TargetValue.clearCache();
+		Ident.clearCache();
+		Type.clearCache();
+		NodeCache.clearAll();
 		binding_firm_common.ir_finish();
 	}
 	
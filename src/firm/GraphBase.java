@@ -1,6 +1,7 @@
 package firm;
 
-import java.nio.IntBuffer;
+import java.nio.ByteBuffer;
+import java.util.BitSet;
 
 import com.sun.jna.Callback;
 import com.sun.jna.NativeLong;
@@ -8,8 +9,10 @@ import com.sun.jna.Pointer;
 import com.sun.jna.Structure;
 
 import firm.bindings.binding_ircons;
+import firm.bindings.binding_irextbb;
 import firm.bindings.binding_irgmod;
 import firm.bindings.binding_irgraph;
+import firm.bindings.binding_irgwalk;
 import firm.bindings.binding_irnode;
 import firm.bindings.binding_irop;
 import firm.bindings.binding_irvrfy;
@@ -20,6 +23,7 @@ import firm.nodes.Block;
 import firm.nodes.End;
 import firm.nodes.NoMem;
 import firm.nodes.Node;
+import firm.nodes.NodeCache;
 import firm.nodes.NodeVisitor;
 import firm.nodes.Phi;
 import firm.nodes.Start;
@@ -53,6 +57,8 @@ public abstract class GraphBase extends JNAWrapper {
 	}
 	
 	public Node newConst(int value, Mode mode) {
+		if (TargetValue.isSmall(value))
+			return Node.createWrapper(binding_ircons.new_r_Const(ptr, TargetValue.fromLong(value, mode).ptr));
 		return Node.createWrapper(binding_ircons.new_rd_Const_long(Pointer.NULL, ptr, mode.ptr, new NativeLong(value)));
 	}
 	
@@ -61,8 +67,36 @@ public abstract class GraphBase extends JNAWrapper {
 	 * You are not allowed to use the graph anymore after calling this.
 	 */
 	public void free() {
+		NodeCache.disable(ptr);
+		/* free_ir_graph frees the frame type as well */
+		Type.forget(binding_irgraph.get_irg_frame_type(ptr));
 		binding_irgraph.free_ir_graph(ptr);
 	}
+	
+	/**
+	 * Enables the node wrapper cache for this graph. While enabled, all
+	 * functions returning nodes of this graph return the same wrapper object
+	 * for the same node.
+	 * Note: You have to call clearNodeCache() after running native
+	 * transformations (optimisations, lowering, the backend) on the graph.
+	 */
+	public void enableNodeCache() {
+		NodeCache.enable(ptr, getLastIdx());
+	}
+	
+	/** disables the node wrapper cache for this graph */
+	public void disableNodeCache() {
+		NodeCache.disable(ptr);
+	}
+	
+	public boolean isNodeCacheEnabled() {
+		return NodeCache.isEnabled(ptr);
+	}
+	
+	/** drops all cached node wrappers of this graph */
+	public void clearNodeCache() {
+		NodeCache.clear(ptr);
+	}
 
 	/**
 	 * returns associated entity
@@ -90,24 +124,24 @@ public abstract class GraphBase extends JNAWrapper {
 	 * returns the start block
 	 */
 	public Block getStartBlock() {
-		return new Block(binding_irgraph.get_irg_start_block(ptr));
+		return (Block) Node.createWrapper(binding_irgraph.get_irg_start_block(ptr));
 	}
 
 	/**
 	 * returns the start node
 	 */
 	public Start getStart() {
-		return new Start(binding_irgraph.get_irg_start(ptr));
+		return (Start) Node.createWrapper(binding_irgraph.get_irg_start(ptr));
 	}
 	
 	/** returns the end block */
 	public Block getEndBlock() {
-		return new Block(binding_irgraph.get_irg_end_block(ptr));
+		return (Block) Node.createWrapper(binding_irgraph.get_irg_end_block(ptr));
 	}
 	
 	/** returns the end node */
 	public End getEnd() {
-		return new End(binding_irgraph.get_irg_end(ptr));
+		return (End) Node.createWrapper(binding_irgraph.get_irg_end(ptr));
 	}
 	
 	/** returns the initial memory */
@@ -224,92 +258,83 @@ public abstract class GraphBase extends JNAWrapper {
 		return binding_irgraph.get_irg_last_idx(ptr);
 	}
 	
-	private void walkHelper(NodeVisitor walker, Node node) {
-		if (node.visited())
-			return;
-		node.markVisited();
-		
-		node.accept(walker);
-		if (node.getBlock() != null) {
-			walkHelper(walker, node.getBlock());			
-		}
-		for (Node pred : node.getPreds()) {
-			walkHelper(walker, pred);
-		}
-	}
-	
-	private void walkHelperPostorder(NodeVisitor walker, Node node) {
-		if (node.visited())
-			return;
-		node.markVisited();
-		
-		if (node.getBlock() != null) {
-			walkHelperPostorder(walker, node.getBlock());			
-		}
-		for (Node pred : node.getPreds()) {
-			walkHelperPostorder(walker, pred);
-		}
-		node.accept(walker);
-	}
-	
 	/**
-	 * variation of the postorder walker, breaking loops at phi/jump nodes.
-	 * This ensures that all nodes inside a basic block are visited in a
-	 * topological order.
+	 * Explicit stack used by the walkers instead of recursion. Each entry
+	 * remembers the node, its index, a flag (used by walkTopological) and
+	 * the next input to look at (-1 is the block, 0..arity-1 the
+	 * predecessors).
 	 */
-	private void walkTopologicalHelper(NodeVisitor walker, Node node) {
-		if (node.visited())
-			return;
+	private static final class WalkStack {
+		private Node[] nodes = new Node[64];
+		private int[] idxs = new int[64];
+		private boolean[] flags = new boolean[64];
+		private int[] next = new int[64];
+		private int[] arity = new int[64];
+		private int size;
 		
-		/* only break loops at phi/block nodes */
-		boolean isLoopBreaker =
-			node.getClass() == Phi.class || node.getClass() == Block.class;
-		if (isLoopBreaker) {
-			node.markVisited();
+		public void push(Node node, int idx, boolean flag) {
+			if (size == nodes.length) {
+				int newSize = size * 2;
+				Node[] newNodes = new Node[newSize];
+				System.arraycopy(nodes, 0, newNodes, 0, size);
+				nodes = newNodes;
+				idxs = copyOf(idxs, newSize);
+				next = copyOf(next, newSize);
+				arity = copyOf(arity, newSize);
+				boolean[] newFlags = new boolean[newSize];
+				System.arraycopy(flags, 0, newFlags, 0, size);
+				flags = newFlags;
+			}
+			nodes[size] = node;
+			idxs[size] = idx;
+			flags[size] = flag;
+			next[size] = node instanceof Block ? 0 : -1;
+			arity[size] = binding_irnode.get_irn_arity(node.ptr);
+			++size;
 		}
-
-		if (node.getBlock() != null) {
-			walkTopologicalHelper(walker, node.getBlock());
+		
+		private static int[] copyOf(int[] array, int newSize) {
+			int[] result = new int[newSize];
+			System.arraycopy(array, 0, result, 0, array.length);
+			return result;
 		}
-		for (Node pred : node.getPreds()) {
-			walkTopologicalHelper(walker, pred);
+		
+		public boolean isEmpty() {
+			return size == 0;
 		}
 		
-		if (isLoopBreaker || !node.visited())
-			node.accept(walker);
-		node.markVisited();
-	}	
-	
-	private void blockWalkHelper(BlockWalker walker, Node node) {
-		Node nodeBlock = node.getBlock();
-		if (nodeBlock.getClass() == Bad.class)
-			return;
+		/**
+		 * returns the next input of the top node, or null if all inputs
+		 * have been processed
+		 */
+		public Pointer nextInput() {
+			int top = size - 1;
+			Pointer node = nodes[top].ptr;
+			while (next[top] < arity[top]) {
+				int n = next[top]++;
+				Pointer input = n < 0 ? binding_irnode.get_nodes_block(node)
+						: binding_irnode.get_irn_n(node, n);
+				if (input != null)
+					return input;
+			}
+			return null;
+		}
 		
-		Block block = (Block) nodeBlock;
-		if (block.blockVisited())
-			return;
-		block.markBlockVisited();
+		public Node top() {
+			return nodes[size - 1];
+		}
 		
-		walker.visitBlock(block);
-		for (Node pred : block.getPreds()) {
-			blockWalkHelper(walker, pred);
-		}		
-	}
-	
-	private void blockWalkHelperPostorder(BlockWalker walker, Node node) {
-		Node nodeBlock = node.getBlock();
-		if (nodeBlock.getClass() == Bad.class)
-			return;
+		public int topIdx() {
+			return idxs[size - 1];
+		}
 		
-		Block block = (Block) nodeBlock;
-		if (block.blockVisited())
-			return;
-		block.markBlockVisited();
+		public boolean topFlag() {
+			return flags[size - 1];
+		}
 		
-		for (Node pred : block.getPreds()) {
-			blockWalkHelperPostorder(walker, pred);
-		}		
-		walker.visitBlock(block);
+		public void pop() {
+			nodes[--size] = null;
+		}
 	}
 	
 	protected void incrementNodeVisited() {
@@ -322,11 +347,35 @@ public abstract class GraphBase extends JNAWrapper {
 	
 	/**
 	 * visits all nodes of the graph, starting at the end node
+	 * (Note: the java walkers keep their own visited set, they don't
+	 *  touch the firm visited flags of nodes)
 	 * @param walker
 	 */
 	public void walk(NodeVisitor walker) {
-		incrementNodeVisited();
-		walkHelper(walker, getEnd());
+		BitSet visited = new BitSet(getLastIdx());
+		WalkStack stack = new WalkStack();
+		
+		Node end = getEnd();
+		int endIdx = end.getIdx();
+		visited.set(endIdx);
+		end.accept(walker);
+		stack.push(end, endIdx, false);
+		
+		while (!stack.isEmpty()) {
+			Pointer input = stack.nextInput();
+			if (input == null) {
+				stack.pop();
+				continue;
+			}
+			int idx = binding_irnode.get_irn_idx(input);
+			if (visited.get(idx))
+				continue;
+			visited.set(idx);
+			
+			Node node = Node.createWrapper(input);
+			node.accept(walker);
+			stack.push(node, idx, false);
+		}
 	}
 	
 	/**
@@ -336,34 +385,250 @@ public abstract class GraphBase extends JNAWrapper {
 	 * @param walker
 	 */
 	public void walkPostorder(NodeVisitor walker) {
-		incrementNodeVisited();
-		walkHelperPostorder(walker, getEnd());
+		BitSet visited = new BitSet(getLastIdx());
+		WalkStack stack = new WalkStack();
+		
+		Node end = getEnd();
+		int endIdx = end.getIdx();
+		visited.set(endIdx);
+		stack.push(end, endIdx, false);
+		
+		while (!stack.isEmpty()) {
+			Pointer input = stack.nextInput();
+			if (input == null) {
+				stack.top().accept(walker);
+				stack.pop();
+				continue;
+			}
+			int idx = binding_irnode.get_irn_idx(input);
+			if (visited.get(idx))
+				continue;
+			visited.set(idx);
+			
+			stack.push(Node.createWrapper(input), idx, false);
+		}
 	}
 	
 	/**
 	 * walks all graph nodes, ensuring that nodes inside a basic block are visited in
 	 * topological order. Nodes in different blocks might still get visited in an
 	 * interleaved order.
+	 * (This is a postorder walk breaking loops at phi/block nodes)
 	 */
 	public void walkTopological(NodeVisitor visitor) {
-		incrementNodeVisited();
-		walkTopologicalHelper(visitor, getEnd());
-	}	
+		BitSet visited = new BitSet(getLastIdx());
+		WalkStack stack = new WalkStack();
+		
+		Node end = getEnd();
+		stack.push(end, end.getIdx(), false);
+		
+		while (!stack.isEmpty()) {
+			Pointer input = stack.nextInput();
+			if (input == null) {
+				/* only loop breakers are marked before their predecessors,
+				 * other nodes may have been visited through a loop meanwhile */
+				int idx = stack.topIdx();
+				if (stack.topFlag() || !visited.get(idx))
+					stack.top().accept(visitor);
+				visited.set(idx);
+				stack.pop();
+				continue;
+			}
+			int idx = binding_irnode.get_irn_idx(input);
+			if (visited.get(idx))
+				continue;
+			
+			Node node = Node.createWrapper(input);
+			/* only break loops at phi/block nodes */
+			boolean isLoopBreaker =
+				node.getClass() == Phi.class || node.getClass() == Block.class;
+			if (isLoopBreaker) {
+				visited.set(idx);
+			}
+			stack.push(node, idx, isLoopBreaker);
+		}
+	}
+	
+	/**
+	 * returns the block of node if it has not been visited yet (and marks
+	 * it), null otherwise or if the block is Bad
+	 */
+	private static Block enterBlockOf(Pointer node, BitSet visited) {
+		Pointer blockPtr = binding_irnode.get_nodes_block(node);
+		int idx = binding_irnode.get_irn_idx(blockPtr);
+		if (visited.get(idx))
+			return null;
+		
+		Node nodeBlock = Node.createWrapper(blockPtr);
+		if (nodeBlock.getClass() == Bad.class)
+			return null;
+		
+		visited.set(idx);
+		return (Block) nodeBlock;
+	}
+	
+	private void blockWalk(BlockWalker walker, boolean postorder) {
+		BitSet visited = new BitSet(getLastIdx());
+		WalkStack stack = new WalkStack();
+		
+		Block endBlock = enterBlockOf(getEnd().ptr, visited);
+		if (endBlock == null)
+			return;
+		if (!postorder)
+			walker.visitBlock(endBlock);
+		stack.push(endBlock, 0, false);
+		
+		while (!stack.isEmpty()) {
+			Pointer pred = stack.nextInput();
+			if (pred == null) {
+				if (postorder)
+					walker.visitBlock((Block) stack.top());
+				stack.pop();
+				continue;
+			}
+			
+			Block block = enterBlockOf(pred, visited);
+			if (block == null)
+				continue;
+			if (!postorder)
+				walker.visitBlock(block);
+			stack.push(block, 0, false);
+		}
+	}
 	
 	/**
 	 * Visits all block nodes in a graph
 	 */
 	public void walkBlocks(BlockWalker walker) {
-		incrementBlockVisited();
-		blockWalkHelper(walker, getEnd());
+		blockWalk(walker, false);
 	}
 	
 	/**
 	 * Visits all block nodes in a graph in postorder
 	 */
 	public void walkBlocksPostorder(BlockWalker walker) {
-		incrementBlockVisited();
-		blockWalkHelperPostorder(walker, getEnd());
+		blockWalk(walker, true);
+	}
+	
+	/**
+	 * Visits all nodes of the graph using the native firm walker
+	 * (irg_walk_graph). pre is called before the predecessors of a node are
+	 * visited, post afterwards; either may be null.
+	 * This needs a single native callback per node and doesn't recurse on
+	 * the java stack, so prefer it over walk()/walkPostorder() for big graphs.
+	 * Note: the walker uses the graph visited flags, so you must not start
+	 * another walk on the same graph from inside the visitors.
+	 */
+	public void nativeWalk(NodeVisitor pre, NodeVisitor post) {
+		WalkCallback preCallback = WalkCallback.create(pre);
+		WalkCallback postCallback = WalkCallback.create(post);
+		binding_irgwalk.irg_walk_graph(ptr, preCallback, postCallback, Pointer.NULL);
+		WalkCallback.rethrow(preCallback, postCallback);
+	}
+	
+	/**
+	 * Visits all block nodes of the graph using the native firm walker
+	 * (irg_block_walk_graph). pre is called before the control flow
+	 * predecessors of a block are visited, post afterwards; either may be
+	 * null.
+	 */
+	public void nativeWalkBlocks(BlockWalker pre, BlockWalker post) {
+		WalkCallback preCallback = WalkCallback.create(pre);
+		WalkCallback postCallback = WalkCallback.create(post);
+		binding_irgwalk.irg_block_walk_graph(ptr, preCallback, postCallback, Pointer.NULL);
+		WalkCallback.rethrow(preCallback, postCallback);
+	}
+	
+	/**
+	 * Visits all nodes of the graph block-wise using the native firm walker
+	 * (irg_walk_blkwise_graph): all nodes of a block are visited before
+	 * the walker continues with the next block. pre and post may be null.
+	 */
+	public void nativeWalkBlockwise(NodeVisitor pre, NodeVisitor post) {
+		WalkCallback preCallback = WalkCallback.create(pre);
+		WalkCallback postCallback = WalkCallback.create(post);
+		binding_irgwalk.irg_walk_blkwise_graph(ptr, preCallback, postCallback, Pointer.NULL);
+		WalkCallback.rethrow(preCallback, postCallback);
+	}
+	
+	/**
+	 * Exports the graph into primitive arrays indexed by node idx (opcodes,
+	 * modes, blocks, predecessors and Const values) with a single native
+	 * walk. See GraphView.
+	 */
+	public GraphView snapshot() {
+		return new GraphView((Graph) this);
+	}
+	
+	/**
+	 * Computes the users of all nodes in one go from the irouts data
+	 * structure (edges don't need to be activated). See OutEdges.
+	 */
+	public OutEdges computeOutEdges() {
+		return new OutEdges((Graph) this);
+	}
+	
+	/**
+	 * Computes the dominator tree (assure_doms) and exports it, see
+	 * DominatorTree.
+	 */
+	public DominatorTree computeDominatorTree() {
+		return new DominatorTree((Graph) this, false);
+	}
+	
+	/**
+	 * Computes the postdominator tree (assure_postdoms) and exports it, see
+	 * DominatorTree.
+	 */
+	public DominatorTree computePostDominatorTree() {
+		return new DominatorTree((Graph) this, true);
+	}
+	
+	/**
+	 * Constructs the control flow loop tree (construct_cf_backedges) and
+	 * exports it, see LoopTree.
+	 */
+	public LoopTree computeLoopTree() {
+		return new LoopTree((Graph) this);
+	}
+	
+	/**
+	 * Runs the value range propagation (set_vrp_data) and exports the
+	 * results, see ValueRanges.
+	 */
+	public ValueRanges computeValueRanges() {
+		return new ValueRanges((Graph) this);
+	}
+	
+	/**
+	 * Computes the extended basic blocks (compute_extbb) and exports them,
+	 * see ExtendedBlocks.
+	 */
+	public ExtendedBlocks computeExtendedBlocks() {
+		return new ExtendedBlocks((Graph) this, null);
+	}
+	
+	/**
+	 * Computes the extended basic blocks, preferring the most frequently
+	 * executed successor when extending a block (compute_extbb_execfreqs).
+	 */
+	public ExtendedBlocks computeExtendedBlocks(ExecFreq execFreq) {
+		return new ExtendedBlocks((Graph) this, execFreq);
+	}
+	
+	/**
+	 * Visits all extended basic blocks of the graph using the native walker
+	 * (irg_extblock_walk_graph). The extended blocks are computed first if
+	 * they are not valid. pre is called before the predecessors of an
+	 * extended block are visited, post afterwards; either may be null.
+	 */
+	public void walkExtendedBlocks(ExtendedBlockWalker pre, ExtendedBlockWalker post) {
+		if (binding_irgraph.get_irg_extblk_state(ptr) != binding_irgraph.irg_extblk_info_state.ir_extblk_info_valid.val)
+			binding_irextbb.compute_extbb(ptr);
+		WalkCallback preCallback = WalkCallback.create(pre);
+		WalkCallback postCallback = WalkCallback.create(post);
+		binding_irextbb.irg_extblock_walk_graph(ptr, preCallback, postCallback, Pointer.NULL);
+		WalkCallback.rethrow(preCallback, postCallback);
 	}
 	
 	public void setPhaseState(binding_irgraph.irg_phase_state state) {
@@ -408,6 +673,7 @@ public abstract class GraphBase extends JNAWrapper {
 	 *  @param outArity The number of values formed into a Tuple.
 	 */
 	public static Node turnIntoTuple(Node node, int outArity) {
+		NodeCache.invalidate(node);
 		binding_irgmod.turn_into_tuple(node.ptr, outArity);
 		Node tuple = Node.createWrapper(node.ptr);
 		for (int i = 0; i < outArity; ++i) {
@@ -421,6 +687,7 @@ public abstract class GraphBase extends JNAWrapper {
 	 * exchange the node by Bad itself.
 	 */
 	public static void killNode(Node node) {
+		NodeCache.invalidate(node);
 		binding_irgmod.kill_node(node.ptr);
 	}
 
@@ -431,6 +698,7 @@ public abstract class GraphBase extends JNAWrapper {
 	public static void exchange(Node oldNode, Node newNode) {
 		assert oldNode != newNode;
 		assert !oldNode.equals(newNode);
+		NodeCache.invalidate(oldNode);
 		binding_irgmod.exchange(oldNode.ptr, newNode.ptr);
 	}
 	
@@ -484,10 +752,9 @@ public abstract class GraphBase extends JNAWrapper {
 		Pointer op = binding_irnode.get_irn_op(node.ptr);
 		Pointer mode = binding_irnode.get_irn_mode(node.ptr);
 		int arity = binding_irnode.get_irn_arity(node.ptr);
-		IntBuffer ins = IntBuffer.allocate(arity);
+		ByteBuffer ins = Node.getPointerBuffer(arity);
 		for (int i = 0; i < arity; ++i) {
-			assert Pointer.SIZE == 4; // There is no PointerBuffer...
-			ins.put(i, (int) Pointer.nativeValue(node.getPred(i).ptr));
+			Node.putPointer(ins, i, binding_irnode.get_irn_n(node.ptr, i));
 		}
 		Pointer block;
 		if (node.getOpCode() == ir_opcode.iro_Block) {
@@ -0,0 +1,210 @@
+package firm;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+
+import com.sun.jna.Pointer;
+
+import firm.bindings.binding_irgwalk;
+import firm.bindings.binding_irnode;
+import firm.bindings.binding_tv;
+import firm.bindings.binding_irnode.ir_opcode;
+import firm.nodes.Node;
+
+/**
+ * A read-only snapshot of a graph stored in primitive arrays indexed by node
+ * idx (see Node.getIdx()). This allows analyses to run over the graph
+ * without a native call for each opcode/mode/block/predecessor access.
+ *
+ * The snapshot is not updated when the graph changes; create a new one with
+ * Graph.snapshot() after modifying the graph.
+ * Only nodes reachable from the end node are contained, all other indices
+ * have the opcode -1.
+ */
+public final class GraphView {
+
+	/** the graph this is a snapshot of */
+	public final Graph graph;
+
+	/** number of node indices (Graph.getLastIdx() at the time of the snapshot) */
+	public final int size;
+
+	/** opcodes (ir_opcode.val) of the nodes or -1 for unused indices */
+	public final int[] opcodes;
+
+	/** mode ids of the nodes, see getMode() */
+	public final int[] modes;
+
+	/** idx of the block of the nodes or -1 for blocks */
+	public final int[] blocks;
+
+	/**
+	 * start of the predecessor list of the nodes in preds. The predecessors
+	 * of node i are preds[predStart[i]] .. preds[predStart[i+1] - 1].
+	 */
+	public final int[] predStart;
+
+	/** idx of the predecessors of all nodes (see predStart) */
+	public final int[] preds;
+
+	/**
+	 * values of Const nodes which fit into a long (check hasLongValue).
+	 */
+	public final long[] longValues;
+
+	/** true for Const nodes whose value is stored in longValues */
+	public final boolean[] hasLongValue;
+
+	private final Pointer[] nodes;
+	private final Mode[] modeTable;
+
+	private static final int CONST = ir_opcode.iro_Const.val;
+
+	/** collects the node data while the native walker runs */
+	private static final class Collector implements binding_irgwalk.irg_walk_func {
+		private final int size;
+		private final Pointer[] nodes;
+		private final int[] opcodes;
+		private final int[] modes;
+		private final int[] blocks;
+		private final int[] predOffset;
+		private final int[] arity;
+		private final long[] longValues;
+		private final boolean[] hasLongValue;
+		private final Map<Pointer, Integer> modeIds = new HashMap<Pointer, Integer>();
+		private final List<Mode> modeTable = new ArrayList<Mode>();
+		private int[] predList = new int[256];
+		private int nPreds;
+
+		public Collector(int size) {
+			this.size = size;
+			nodes = new Pointer[size];
+			opcodes = new int[size];
+			Arrays.fill(opcodes, -1);
+			modes = new int[size];
+			blocks = new int[size];
+			Arrays.fill(blocks, -1);
+			predOffset = new int[size];
+			arity = new int[size];
+			longValues = new long[size];
+			hasLongValue = new boolean[size];
+		}
+
+		private int getModeId(Pointer mode) {
+			Integer id = modeIds.get(mode);
+			if (id == null) {
+				id = modeTable.size();
+				modeIds.put(mode, id);
+				modeTable.add(Mode.createWrapper(mode));
+			}
+			return id;
+		}
+
+		@Override
+		public void callback(Pointer node, Pointer env) {
+			int idx = binding_irnode.get_irn_idx(node);
+			int opcode = binding_irnode.get_irn_opcode(node);
+			nodes[idx] = node;
+			opcodes[idx] = opcode;
+			modes[idx] = getModeId(binding_irnode.get_irn_mode(node));
+			if (binding_irnode.is_Block(node) == 0) {
+				blocks[idx] = binding_irnode.get_irn_idx(binding_irnode.get_nodes_block(node));
+			}
+
+			int n = binding_irnode.get_irn_arity(node);
+			if (nPreds + n > predList.length) {
+				predList = Arrays.copyOf(predList, Math.max(nPreds + n, predList.length * 2));
+			}
+			predOffset[idx] = nPreds;
+			arity[idx] = n;
+			for (int i = 0; i < n; ++i) {
+				predList[nPreds++] = binding_irnode.get_irn_idx(binding_irnode.get_irn_n(node, i));
+			}
+
+			if (opcode == CONST) {
+				Pointer tarval = binding_irnode.get_Const_tarval(node);
+				if (binding_tv.tarval_is_long(tarval) != 0) {
+					longValues[idx] = binding_tv.get_tarval_long(tarval).longValue();
+					hasLongValue[idx] = true;
+				}
+			}
+		}
+	}
+
+	GraphView(Graph graph) {
+		this.graph = graph;
+
+		Collector collector = new Collector(graph.getLastIdx());
+		binding_irgwalk.irg_walk_graph(graph.ptr, collector, null, Pointer.NULL);
+
+		size = collector.size;
+		nodes = collector.nodes;
+		opcodes = collector.opcodes;
+		modes = collector.modes;
+		blocks = collector.blocks;
+		longValues = collector.longValues;
+		hasLongValue = collector.hasLongValue;
+		modeTable = collector.modeTable.toArray(new Mode[collector.modeTable.size()]);
+
+		/* bring predecessor lists into idx order */
+		predStart = new int[size + 1];
+		preds = new int[collector.nPreds];
+		int pos = 0;
+		for (int idx = 0; idx < size; ++idx) {
+			predStart[idx] = pos;
+			System.arraycopy(collector.predList, collector.predOffset[idx], preds, pos, collector.arity[idx]);
+			pos += collector.arity[idx];
+		}
+		predStart[size] = pos;
+	}
+
+	/** returns the number of predecessors of a node */
+	public int getPredCount(int idx) {
+		return predStart[idx + 1] - predStart[idx];
+	}
+
+	/** returns the idx of the n-th predecessor of a node */
+	public int getPred(int idx, int n) {
+		return preds[predStart[idx] + n];
+	}
+
+	/** returns true if idx belongs to a node contained in the snapshot */
+	public boolean contains(int idx) {
+		return idx >= 0 && idx < size && opcodes[idx] >= 0;
+	}
+
+	/** returns the number of different modes used in the graph */
+	public int getNModes() {
+		return modeTable.length;
+	}
+
+	/** returns the Mode for a mode id from the modes array */
+	public Mode getMode(int modeId) {
+		return modeTable[modeId];
+	}
+
+	/** returns the opcode of a node as enum */
+	public ir_opcode getOpCode(int idx) {
+		return ir_opcode.getEnum(opcodes[idx]);
+	}
+
+	/**
+	 * returns a wrapper object for the node with the given idx (or null if
+	 * the node is not contained in the snapshot)
+	 */
+	public Node getNode(int idx) {
+		if (!contains(idx))
+			return null;
+		return Node.createWrapper(nodes[idx]);
+	}
+
+	/** returns the native node with the given idx (null if not contained) */
+	Pointer getPointer(int idx) {
+		if (!contains(idx))
+			return null;
+		return nodes[idx];
+	}
+}
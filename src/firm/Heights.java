@@ -0,0 +1,93 @@
+package firm;
+
+import java.io.Closeable;
+
+import com.sun.jna.Pointer;
+
+import firm.bindings.binding_heights;
+import firm.bindings.binding_irgwalk;
+import firm.bindings.binding_irnode;
+import firm.nodes.Block;
+import firm.nodes.Node;
+
+/**
+ * The height of the nodes of a graph (heights.h): the maximal number of
+ * edges between a sink node of the block and the node itself (plus 1),
+ * i.e. the critical path length used by scheduling heuristics.
+ *
+ * The native data must be released with close().
+ */
+public class Heights implements Closeable {
+
+	/** the graph */
+	public final Graph graph;
+
+	private Pointer ptr;
+
+	/** computes the heights of all nodes of a graph */
+	public Heights(Graph graph) {
+		this.graph = graph;
+		this.ptr = binding_heights.heights_new(graph.ptr);
+	}
+
+	private Pointer getPtr() {
+		if (ptr == null)
+			throw new IllegalStateException("Heights already closed");
+		return ptr;
+	}
+
+	/** returns the height of a node */
+	public int getHeight(Node node) {
+		return binding_heights.get_irn_height(getPtr(), node.ptr);
+	}
+
+	/**
+	 * returns true if m is reachable from n following the predecessors of n
+	 * inside their block (both nodes must be in the same block)
+	 */
+	public boolean reachableInBlock(Node n, Node m) {
+		return binding_heights.heights_reachable_in_block(getPtr(), n.ptr, m.ptr) != 0;
+	}
+
+	/** recomputes the heights of all nodes after the graph changed */
+	public void recompute() {
+		binding_heights.heights_recompute(getPtr());
+	}
+
+	/**
+	 * recomputes the heights of the nodes in a block, returns the maximal
+	 * height in the block
+	 */
+	public int recomputeBlock(Block block) {
+		return binding_heights.heights_recompute_block(getPtr(), block.ptr);
+	}
+
+	/**
+	 * returns the heights of all nodes in an array indexed by node idx
+	 * (see Node.getIdx()). Unreachable nodes and blocks have height 0.
+	 */
+	public int[] exportHeights() {
+		final Pointer heights = getPtr();
+		final int[] result = new int[graph.getLastIdx()];
+		binding_irgwalk.irg_walk_graph(graph.ptr, new binding_irgwalk.irg_walk_func() {
+			@Override
+			public void callback(Pointer node, Pointer env) {
+				if (binding_irnode.is_Block(node) != 0)
+					return;
+				int idx = binding_irnode.get_irn_idx(node);
+				if (idx < result.length)
+					result[idx] = binding_heights.get_irn_height(heights, node);
+			}
+		}, null, Pointer.NULL);
+		return result;
+	}
+
+	/** releases the native data, further calls are not allowed */
+	@Override
+	public void close() {
+		if (ptr == null)
+			return;
+		binding_heights.heights_free(ptr);
+		ptr = null;
+	}
+}
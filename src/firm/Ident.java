@@ -1,21 +1,66 @@
 package firm;
 
+import java.util.LinkedHashMap;
+import java.util.Map;
+import java.util.regex.Matcher;
+
 import com.sun.jna.Pointer;
 
 import firm.bindings.binding_ident;
 
 public class Ident extends JNAWrapper {
 	
+	/** maximum number of strings kept in the intern table */
+	private static final int MAX_INTERNED = 16384;
+	
+	/** java side intern table, least recently used strings are dropped first */
+	private static final Map<String, Ident> interned = new LinkedHashMap<String, Ident>(256, 0.75f, true) {
+		private static final long serialVersionUID = 1L;
+		
+		@Override
+		protected boolean removeEldestEntry(Map.Entry<String, Ident> eldest) {
+			return size() > MAX_INTERNED;
+		}
+	};
+	
+	/** inserted before the %u of createUnique tags, see setUniquePrefix() */
+	private static String uniquePrefix = "";
+	
+	/** java copy of the identifier string, null if not known yet */
+	private String string;
+	
 	public Ident(Pointer ptr) {
 		super(ptr);
 	}
 	
 	public Ident(String string) {
 		this(binding_ident.new_id_from_str(string));
+		this.string = string;
+	}
+	
+	/**
+	 * returns the identifier for a string. Unlike new Ident(string) this
+	 * looks into a java side table first, so repeatedly used names don't
+	 * need a call into libfirm.
+	 */
+	public static Ident intern(String string) {
+		Ident ident = interned.get(string);
+		if (ident == null) {
+			ident = new Ident(string);
+			interned.put(string, ident);
+		}
+		return ident;
+	}
+	
+	/** forget interned identifiers, they are invalid after Firm.finish() */
+	static void clearCache() {
+		interned.clear();
 	}
 	
 	public String getString() {
-		return binding_ident.get_id_str(ptr);
+		if (string == null)
+			string = binding_ident.get_id_str(ptr);
+		return string;
 	}
 	
 	@Override
@@ -39,10 +84,24 @@ public class Ident extends JNAWrapper {
 	 * @return
 	 */
 	public final static Ident createUnique(String tag) {
+		if (uniquePrefix.length() > 0)
+			tag = tag.replaceFirst("%u", Matcher.quoteReplacement(uniquePrefix) + "%u");
 		Pointer pIdent = binding_ident.id_unique(tag);
 		return new Ident(pIdent);
 	}
 	
+	/**
+	 * sets a string inserted before the number of all following
+	 * createUnique() names. Processes compiling parts of the same program
+	 * use different prefixes, so their unique names don't clash when the
+	 * outputs are combined. The prefix must not contain '%'.
+	 */
+	public final static void setUniquePrefix(String prefix) {
+		if (prefix.indexOf('%') >= 0)
+			throw new IllegalArgumentException("unique prefix must not contain '%'");
+		uniquePrefix = prefix;
+	}
+	
 	public final static Ident mangleEntity(Entity ent) {
 		Pointer pIdent = binding_ident.id_mangle_entity(ent.ptr);
 		return new Ident(pIdent);
@@ -68,6 +127,14 @@ public class Ident extends JNAWrapper {
 		return new Ident(pIdent);
 	}
 
+	public final static Ident mangleUnderscore(String first, String second) {
+		return mangleUnderscore(intern(first), intern(second));
+	}
+
+	public final static Ident mangleDot(String first, String second) {
+		return mangleDot(intern(first), intern(second));
+	}
+
 	public final static Ident decorateWin32CFkt(Entity ent, Ident id) {
 		Pointer pIdent = binding_ident.id_decorate_win32_c_fkt(ent.ptr, id.ptr);
 		return new Ident(pIdent);
@@ -0,0 +1,306 @@
+package firm;
+
+import firm.TargetValue.int_overflow_mode;
+import firm.bindings.binding_irnode.ir_opcode;
+
+/**
+ * Rules for the LocalRewriter: constant folding, algebraic simplification
+ * and strength reduction. All rules only handle integer modes which can be
+ * folded in a java long (like TargetValue does); arithmetic which may
+ * overflow is only folded when the integer overflow mode is wrap-around.
+ */
+public final class LocalRewriteRules {
+
+	private LocalRewriteRules() {
+	}
+
+	/** registers all rules of this class */
+	public static void addAll(LocalRewriter rewriter) {
+		addConstantFolding(rewriter);
+		addAlgebraicSimplification(rewriter);
+		addStrengthReduction(rewriter);
+	}
+
+	/** returns the fold bit size of the mode of a node (0: not foldable) */
+	private static int foldBits(LocalRewriter rewriter, int node) {
+		return rewriter.getMode(node).getFoldBits();
+	}
+
+	private static boolean isConst(LocalRewriter rewriter, int node, long value) {
+		return rewriter.isConst(node) && rewriter.getLongValue(node) == value;
+	}
+
+	private static boolean isAllOne(LocalRewriter rewriter, int node) {
+		Mode mode = rewriter.getMode(node);
+		return rewriter.isConst(node)
+			&& rewriter.getLongValue(node) == TargetValue.wrap(-1, mode.getFoldBits(), mode.isFoldSigned());
+	}
+
+	/** folds the binary operations with constant operands */
+	private static final LocalRewriter.Rule FOLD_BINOP = new LocalRewriter.Rule() {
+		@Override
+		public boolean rewrite(LocalRewriter rewriter, int node) {
+			int bits = foldBits(rewriter, node);
+			if (bits == 0)
+				return false;
+			int left = rewriter.getPred(node, 0);
+			int right = rewriter.getPred(node, 1);
+			if (!rewriter.isConst(left) || !rewriter.isConst(right))
+				return false;
+			int modeId = rewriter.getModeId(node);
+			if (rewriter.getModeId(left) != modeId)
+				return false;
+
+			Mode mode = rewriter.getMode(node);
+			long l = rewriter.getLongValue(left);
+			long r = rewriter.getLongValue(right);
+			long result;
+			boolean arithmetic = false;
+			switch (rewriter.getOpCode(node)) {
+			case iro_Add: result = l + r; arithmetic = true; break;
+			case iro_Sub: result = l - r; arithmetic = true; break;
+			case iro_Mul: result = l * r; arithmetic = true; break;
+			case iro_And: result = l & r; break;
+			case iro_Or:  result = l | r; break;
+			case iro_Eor: result = l ^ r; break;
+			case iro_Shl:
+			case iro_Shr:
+			case iro_Shrs: {
+				if (r < 0)
+					return false;
+				int moduloShift = mode.getFoldModuloShift();
+				long count = moduloShift != 0 ? r % moduloShift : r;
+				count = Math.min(count, 64);
+				switch (rewriter.getOpCode(node)) {
+				case iro_Shl:
+					result = count < 64 ? l << count : 0;
+					break;
+				case iro_Shr: {
+					long unsigned = TargetValue.wrap(l, bits, false);
+					result = count < 64 ? unsigned >>> count : 0;
+					break;
+				}
+				default:
+					result = TargetValue.wrap(l, bits, true) >> Math.min(count, 63);
+					break;
+				}
+				break;
+			}
+			default:
+				return false;
+			}
+
+			if (arithmetic) {
+				long wrapped = TargetValue.wrap(result, bits, mode.isFoldSigned());
+				/* operations on more than 32 bits might have overflowed the long */
+				boolean mayOverflow = wrapped != result || bits > 32;
+				if (mayOverflow && TargetValue.getIntegerOverflowMode() != int_overflow_mode.TV_OVERFLOW_WRAP)
+					return false;
+			}
+			rewriter.replace(node, rewriter.newConst(result, modeId));
+			return true;
+		}
+	};
+
+	/** folds Minus and Not of constants */
+	private static final LocalRewriter.Rule FOLD_UNOP = new LocalRewriter.Rule() {
+		@Override
+		public boolean rewrite(LocalRewriter rewriter, int node) {
+			int bits = foldBits(rewriter, node);
+			if (bits == 0)
+				return false;
+			int op = rewriter.getPred(node, 0);
+			int modeId = rewriter.getModeId(node);
+			if (!rewriter.isConst(op) || rewriter.getModeId(op) != modeId)
+				return false;
+			Mode mode = rewriter.getMode(node);
+			long value = rewriter.getLongValue(op);
+			long result;
+			if (rewriter.getOpCode(node) == ir_opcode.iro_Not) {
+				result = ~value;
+			} else {
+				if (!mode.isFoldSigned())
+					return false;
+				result = -value;
+				long wrapped = TargetValue.wrap(result, bits, true);
+				boolean mayOverflow = wrapped != result || bits > 32;
+				if (mayOverflow && TargetValue.getIntegerOverflowMode() != int_overflow_mode.TV_OVERFLOW_WRAP)
+					return false;
+			}
+			rewriter.replace(node, rewriter.newConst(result, modeId));
+			return true;
+		}
+	};
+
+	/** registers constant folding of arithmetic, bit and shift operations */
+	public static void addConstantFolding(LocalRewriter rewriter) {
+		rewriter.addRule(ir_opcode.iro_Add, FOLD_BINOP);
+		rewriter.addRule(ir_opcode.iro_Sub, FOLD_BINOP);
+		rewriter.addRule(ir_opcode.iro_Mul, FOLD_BINOP);
+		rewriter.addRule(ir_opcode.iro_And, FOLD_BINOP);
+		rewriter.addRule(ir_opcode.iro_Or, FOLD_BINOP);
+		rewriter.addRule(ir_opcode.iro_Eor, FOLD_BINOP);
+		rewriter.addRule(ir_opcode.iro_Shl, FOLD_BINOP);
+		rewriter.addRule(ir_opcode.iro_Shr, FOLD_BINOP);
+		rewriter.addRule(ir_opcode.iro_Shrs, FOLD_BINOP);
+		rewriter.addRule(ir_opcode.iro_Minus, FOLD_UNOP);
+		rewriter.addRule(ir_opcode.iro_Not, FOLD_UNOP);
+	}
+
+	/**
+	 * simplifies binary operations with neutral or absorbing operands and
+	 * with the same value on both sides
+	 */
+	private static final LocalRewriter.Rule SIMPLIFY_BINOP = new LocalRewriter.Rule() {
+		@Override
+		public boolean rewrite(LocalRewriter rewriter, int node) {
+			if (foldBits(rewriter, node) == 0)
+				return false;
+			int left = rewriter.getPred(node, 0);
+			int right = rewriter.getPred(node, 1);
+			int modeId = rewriter.getModeId(node);
+			if (rewriter.getModeId(left) != modeId)
+				return false;
+
+			int result = -1;
+			switch (rewriter.getOpCode(node)) {
+			case iro_Add:
+				if (isConst(rewriter, right, 0))
+					result = left;
+				else if (isConst(rewriter, left, 0) && rewriter.getModeId(right) == modeId)
+					result = right;
+				break;
+			case iro_Sub:
+				if (isConst(rewriter, right, 0))
+					result = left;
+				else if (left == right)
+					result = rewriter.newConst(0, modeId);
+				break;
+			case iro_Mul:
+				if (isConst(rewriter, right, 1))
+					result = left;
+				else if (isConst(rewriter, left, 1))
+					result = right;
+				else if (isConst(rewriter, right, 0))
+					result = right;
+				else if (isConst(rewriter, left, 0))
+					result = left;
+				break;
+			case iro_And:
+				if (left == right || isAllOne(rewriter, right))
+					result = left;
+				else if (isAllOne(rewriter, left))
+					result = right;
+				else if (isConst(rewriter, right, 0))
+					result = right;
+				else if (isConst(rewriter, left, 0))
+					result = left;
+				break;
+			case iro_Or:
+				if (left == right || isConst(rewriter, right, 0))
+					result = left;
+				else if (isConst(rewriter, left, 0))
+					result = right;
+				else if (isAllOne(rewriter, right))
+					result = right;
+				else if (isAllOne(rewriter, left))
+					result = left;
+				break;
+			case iro_Eor:
+				if (isConst(rewriter, right, 0))
+					result = left;
+				else if (isConst(rewriter, left, 0))
+					result = right;
+				else if (left == right)
+					result = rewriter.newConst(0, modeId);
+				break;
+			case iro_Shl:
+			case iro_Shr:
+			case iro_Shrs:
+				if (isConst(rewriter, right, 0))
+					result = left;
+				break;
+			default:
+				break;
+			}
+			if (result < 0)
+				return false;
+			rewriter.replace(node, result);
+			return true;
+		}
+	};
+
+	/** removes double negation: -(-x) and ~(~x) */
+	private static final LocalRewriter.Rule SIMPLIFY_UNOP = new LocalRewriter.Rule() {
+		@Override
+		public boolean rewrite(LocalRewriter rewriter, int node) {
+			int op = rewriter.getPred(node, 0);
+			if (rewriter.getOpcode(op) != rewriter.getOpcode(node))
+				return false;
+			int inner = rewriter.getPred(op, 0);
+			if (rewriter.getModeId(inner) != rewriter.getModeId(node))
+				return false;
+			rewriter.replace(node, inner);
+			return true;
+		}
+	};
+
+	/** registers the algebraic simplifications */
+	public static void addAlgebraicSimplification(LocalRewriter rewriter) {
+		rewriter.addRule(ir_opcode.iro_Add, SIMPLIFY_BINOP);
+		rewriter.addRule(ir_opcode.iro_Sub, SIMPLIFY_BINOP);
+		rewriter.addRule(ir_opcode.iro_Mul, SIMPLIFY_BINOP);
+		rewriter.addRule(ir_opcode.iro_And, SIMPLIFY_BINOP);
+		rewriter.addRule(ir_opcode.iro_Or, SIMPLIFY_BINOP);
+		rewriter.addRule(ir_opcode.iro_Eor, SIMPLIFY_BINOP);
+		rewriter.addRule(ir_opcode.iro_Shl, SIMPLIFY_BINOP);
+		rewriter.addRule(ir_opcode.iro_Shr, SIMPLIFY_BINOP);
+		rewriter.addRule(ir_opcode.iro_Shrs, SIMPLIFY_BINOP);
+		rewriter.addRule(ir_opcode.iro_Minus, SIMPLIFY_UNOP);
+		rewriter.addRule(ir_opcode.iro_Not, SIMPLIFY_UNOP);
+	}
+
+	/**
+	 * replaces multiplications by a power of two with a shift and
+	 * multiplications by -1 with Minus
+	 */
+	private static final LocalRewriter.Rule REDUCE_MUL = new LocalRewriter.Rule() {
+		@Override
+		public boolean rewrite(LocalRewriter rewriter, int node) {
+			if (foldBits(rewriter, node) == 0)
+				return false;
+			int left = rewriter.getPred(node, 0);
+			int right = rewriter.getPred(node, 1);
+			int modeId = rewriter.getModeId(node);
+			int operand;
+			long factor;
+			if (rewriter.isConst(right)) {
+				operand = left;
+				factor = rewriter.getLongValue(right);
+			} else if (rewriter.isConst(left)) {
+				operand = right;
+				factor = rewriter.getLongValue(left);
+			} else {
+				return false;
+			}
+			if (rewriter.getModeId(operand) != modeId)
+				return false;
+
+			int block = rewriter.getBlock(node);
+			if (factor == -1 && rewriter.getMode(node).isFoldSigned()) {
+				rewriter.replace(node, rewriter.newNode(ir_opcode.iro_Minus, block, modeId, operand));
+				return true;
+			}
+			if (factor <= 1 || Long.bitCount(factor) != 1)
+				return false;
+			int shift = rewriter.newConst(Long.numberOfTrailingZeros(factor), rewriter.getModeId(Mode.getIu()));
+			rewriter.replace(node, rewriter.newNode(ir_opcode.iro_Shl, block, modeId, operand, shift));
+			return true;
+		}
+	};
+
+	/** registers the strength reduction rules */
+	public static void addStrengthReduction(LocalRewriter rewriter) {
+		rewriter.addRule(ir_opcode.iro_Mul, REDUCE_MUL);
+	}
+}
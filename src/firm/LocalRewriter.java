@@ -0,0 +1,508 @@
+package firm;
+
+import java.nio.ByteBuffer;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+
+import com.sun.jna.Pointer;
+
+import firm.bindings.binding_ircons;
+import firm.bindings.binding_irgmod;
+import firm.bindings.binding_irgraph;
+import firm.bindings.binding_irnode;
+import firm.bindings.binding_irnode.ir_opcode;
+import firm.nodes.Node;
+import firm.nodes.NodeCache;
+
+/**
+ * A worklist driven engine for local rewrites written in java.
+ *
+ * Rules are registered per opcode and work on node indices of a snapshot
+ * of the graph (see GraphView) instead of native nodes, so matching needs
+ * no native calls. The changes a rule makes (replace(), setPred() and the
+ * new nodes from newConst()/newNode()) are recorded in java and only
+ * applied to the firm graph in one batch at the end of run(). Nodes
+ * created by rules but not used in the end are never created in firm.
+ *
+ * While the rules run, getPred() and getBlock() already return the
+ * replacements of replaced nodes. After a rule changed something, the
+ * users of the affected nodes are put on the worklist again. A rule
+ * returns true if it changed something; it must not return true again
+ * for the same unchanged situation, otherwise run() does not terminate.
+ *
+ * See LocalRewriteRules for constant folding, algebraic simplification and
+ * strength reduction rules.
+ */
+public class LocalRewriter {
+
+	/** a rewrite rule for the nodes of one opcode */
+	public interface Rule {
+		/**
+		 * tries to rewrite a node
+		 * @return true if the rule changed something
+		 */
+		boolean rewrite(LocalRewriter rewriter, int node);
+	}
+
+	private static final int CONST = ir_opcode.iro_Const.val;
+
+	private final Graph graph;
+	private Rule[][] rules = new Rule[0][];
+
+	/* state of the current run */
+	private GraphView view;
+	private int size;
+	private int[] opcodes;
+	private int[] modes;
+	private int[] blocks;
+	private int[] predStart;
+	private int[] predCount;
+	private int[] preds;
+	private int nPreds;
+	private long[] longValues;
+	private boolean[] hasLongValue;
+	private int[] replacement;
+	private int[][] users;
+	private int[] nUsers;
+	private int[] worklist;
+	private int worklistSize;
+	private boolean[] onWorklist;
+	private int[] setPredNodes;
+	private int[] setPredPositions;
+	private int nSetPreds;
+	private List<Mode> modeTable;
+	private Map<Mode, Integer> modeIds;
+	private List<Map<Long, Integer>> constants;
+	private Pointer[] pointers;
+	private int nChanges;
+
+	public LocalRewriter(Graph graph) {
+		this.graph = graph;
+	}
+
+	/** registers a rule for all nodes with the given opcode */
+	public void addRule(ir_opcode opcode, Rule rule) {
+		if (opcode.val >= rules.length) {
+			int oldLength = rules.length;
+			rules = Arrays.copyOf(rules, opcode.val + 1);
+			for (int i = oldLength; i < rules.length; ++i) {
+				rules[i] = new Rule[0];
+			}
+		}
+		Rule[] opRules = Arrays.copyOf(rules[opcode.val], rules[opcode.val].length + 1);
+		opRules[opRules.length - 1] = rule;
+		rules[opcode.val] = opRules;
+	}
+
+	/**
+	 * applies the rules to the graph until no rule matches anymore and
+	 * commits the changes to the graph
+	 * @return the number of successful rule applications
+	 */
+	public int run() {
+		init();
+		try {
+			while (worklistSize > 0) {
+				int node = worklist[--worklistSize];
+				onWorklist[node] = false;
+				if (replacement[node] >= 0)
+					continue;
+				int opcode = opcodes[node];
+				if (opcode < 0 || opcode >= rules.length)
+					continue;
+				for (Rule rule : rules[opcode]) {
+					if (rule.rewrite(this, node)) {
+						++nChanges;
+						break;
+					}
+				}
+			}
+			if (nChanges > 0)
+				commit();
+			return nChanges;
+		} finally {
+			reset();
+		}
+	}
+
+	private void init() {
+		view = graph.snapshot();
+		size = view.size;
+		int capacity = Math.max(size * 2, 16);
+		opcodes = Arrays.copyOf(view.opcodes, capacity);
+		modes = Arrays.copyOf(view.modes, capacity);
+		blocks = Arrays.copyOf(view.blocks, capacity);
+		predStart = Arrays.copyOf(view.predStart, capacity);
+		predCount = new int[capacity];
+		for (int idx = 0; idx < size; ++idx) {
+			predCount[idx] = view.getPredCount(idx);
+		}
+		nPreds = view.preds.length;
+		preds = Arrays.copyOf(view.preds, Math.max(nPreds * 2, 16));
+		longValues = Arrays.copyOf(view.longValues, capacity);
+		hasLongValue = Arrays.copyOf(view.hasLongValue, capacity);
+		replacement = new int[capacity];
+		Arrays.fill(replacement, -1);
+
+		modeTable = new ArrayList<Mode>();
+		modeIds = new HashMap<Mode, Integer>();
+		constants = new ArrayList<Map<Long, Integer>>();
+		for (int m = 0; m < view.getNModes(); ++m) {
+			getModeId(view.getMode(m));
+		}
+
+		/* users, and the existing constants for reuse by newConst() */
+		nUsers = new int[capacity];
+		for (int p = 0; p < nPreds; ++p) {
+			++nUsers[preds[p]];
+		}
+		users = new int[capacity][];
+		for (int idx = 0; idx < size; ++idx) {
+			users[idx] = new int[nUsers[idx]];
+			nUsers[idx] = 0;
+		}
+		for (int idx = 0; idx < size; ++idx) {
+			for (int p = predStart[idx]; p < predStart[idx] + predCount[idx]; ++p) {
+				int pred = preds[p];
+				users[pred][nUsers[pred]++] = idx;
+			}
+			if (opcodes[idx] == CONST && hasLongValue[idx]) {
+				Map<Long, Integer> values = constants.get(modes[idx]);
+				if (!values.containsKey(longValues[idx]))
+					values.put(longValues[idx], idx);
+			}
+		}
+
+		/* the stack pops the lowest indices first, usually operands come first */
+		worklist = new int[capacity];
+		onWorklist = new boolean[capacity];
+		worklistSize = 0;
+		for (int idx = size - 1; idx >= 0; --idx) {
+			if (view.contains(idx))
+				push(idx);
+		}
+
+		setPredNodes = new int[16];
+		setPredPositions = new int[16];
+		nSetPreds = 0;
+		nChanges = 0;
+	}
+
+	private void reset() {
+		view = null;
+		opcodes = null;
+		modes = null;
+		blocks = null;
+		predStart = null;
+		predCount = null;
+		preds = null;
+		longValues = null;
+		hasLongValue = null;
+		replacement = null;
+		users = null;
+		nUsers = null;
+		worklist = null;
+		onWorklist = null;
+		setPredNodes = null;
+		setPredPositions = null;
+		modeTable = null;
+		modeIds = null;
+		constants = null;
+		pointers = null;
+	}
+
+	private void push(int node) {
+		if (onWorklist[node])
+			return;
+		if (worklistSize == worklist.length)
+			worklist = Arrays.copyOf(worklist, worklist.length * 2);
+		worklist[worklistSize++] = node;
+		onWorklist[node] = true;
+	}
+
+	private void addUser(int node, int user) {
+		int[] nodeUsers = users[node];
+		if (nodeUsers == null) {
+			nodeUsers = new int[4];
+		} else if (nUsers[node] == nodeUsers.length) {
+			nodeUsers = Arrays.copyOf(nodeUsers, Math.max(nodeUsers.length * 2, 4));
+		}
+		nodeUsers[nUsers[node]++] = user;
+		users[node] = nodeUsers;
+	}
+
+	/** returns the current replacement of a node (or the node itself) */
+	private int find(int node) {
+		int result = node;
+		while (replacement[result] >= 0) {
+			result = replacement[result];
+		}
+		/* path compression */
+		while (replacement[node] >= 0 && replacement[node] != result) {
+			int next = replacement[node];
+			replacement[node] = result;
+			node = next;
+		}
+		return result;
+	}
+
+	/** makes room for a new node, returns its index */
+	private int allocateNode(int opcode, int block, int modeId, int arity) {
+		int node = size++;
+		if (node == opcodes.length) {
+			int capacity = opcodes.length * 2;
+			opcodes = Arrays.copyOf(opcodes, capacity);
+			modes = Arrays.copyOf(modes, capacity);
+			blocks = Arrays.copyOf(blocks, capacity);
+			predStart = Arrays.copyOf(predStart, capacity);
+			predCount = Arrays.copyOf(predCount, capacity);
+			longValues = Arrays.copyOf(longValues, capacity);
+			hasLongValue = Arrays.copyOf(hasLongValue, capacity);
+			replacement = Arrays.copyOf(replacement, capacity);
+			Arrays.fill(replacement, node, capacity, -1);
+			users = Arrays.copyOf(users, capacity);
+			nUsers = Arrays.copyOf(nUsers, capacity);
+			onWorklist = Arrays.copyOf(onWorklist, capacity);
+		}
+		if (nPreds + arity > preds.length)
+			preds = Arrays.copyOf(preds, Math.max(nPreds + arity, preds.length * 2));
+		opcodes[node] = opcode;
+		modes[node] = modeId;
+		blocks[node] = block;
+		predStart[node] = nPreds;
+		predCount[node] = arity;
+		nPreds += arity;
+		return node;
+	}
+
+	/** returns the graph the rewriter works on */
+	public Graph getGraph() {
+		return graph;
+	}
+
+	/** returns the opcode (ir_opcode.val) of a node */
+	public int getOpcode(int node) {
+		return opcodes[node];
+	}
+
+	/** returns the opcode of a node as enum */
+	public ir_opcode getOpCode(int node) {
+		return ir_opcode.getEnum(opcodes[node]);
+	}
+
+	/** returns the mode id of a node, see getMode(int) */
+	public int getModeId(int node) {
+		return modes[node];
+	}
+
+	/** returns the mode of a node */
+	public Mode getMode(int node) {
+		return modeTable.get(modes[node]);
+	}
+
+	/** returns the mode id of a mode (for newConst/newNode) */
+	public int getModeId(Mode mode) {
+		Integer id = modeIds.get(mode);
+		if (id == null) {
+			id = modeTable.size();
+			modeIds.put(mode, id);
+			modeTable.add(mode);
+			constants.add(new HashMap<Long, Integer>());
+		}
+		return id;
+	}
+
+	/** returns the block of a node or -1 for blocks and new constants */
+	public int getBlock(int node) {
+		int block = blocks[node];
+		return block < 0 ? -1 : find(block);
+	}
+
+	/** returns the number of predecessors of a node */
+	public int getPredCount(int node) {
+		return predCount[node];
+	}
+
+	/** returns the (current replacement of the) n-th predecessor of a node */
+	public int getPred(int node, int n) {
+		return find(preds[predStart[node] + n]);
+	}
+
+	/** returns true if node is a Const whose value fits into a long */
+	public boolean isConst(int node) {
+		return opcodes[node] == CONST && hasLongValue[node];
+	}
+
+	/** returns the value of a Const node (check isConst first) */
+	public long getLongValue(int node) {
+		return longValues[node];
+	}
+
+	/** returns the wrapper of a node of the snapshot (null for new nodes) */
+	public Node getNode(int node) {
+		return view.getNode(node);
+	}
+
+	/**
+	 * replaces all uses of node by other (exchange() when the changes
+	 * are committed)
+	 */
+	public void replace(int node, int other) {
+		node = find(node);
+		other = find(other);
+		if (node == other)
+			return;
+		replacement[node] = other;
+		for (int i = 0; i < nUsers[node]; ++i) {
+			int user = users[node][i];
+			addUser(other, user);
+			push(user);
+		}
+		push(other);
+	}
+
+	/** sets the n-th predecessor of a node */
+	public void setPred(int node, int n, int pred) {
+		pred = find(pred);
+		preds[predStart[node] + n] = pred;
+		addUser(pred, node);
+		if (node < view.size) {
+			if (nSetPreds == setPredNodes.length) {
+				setPredNodes = Arrays.copyOf(setPredNodes, nSetPreds * 2);
+				setPredPositions = Arrays.copyOf(setPredPositions, nSetPreds * 2);
+			}
+			setPredNodes[nSetPreds] = node;
+			setPredPositions[nSetPreds] = n;
+			++nSetPreds;
+		}
+		push(node);
+	}
+
+	/**
+	 * returns a Const node with the given value, an existing one if
+	 * possible
+	 */
+	public int newConst(long value, int modeId) {
+		Mode mode = modeTable.get(modeId);
+		int bits = mode.getFoldBits();
+		if (bits == 0)
+			throw new IllegalArgumentException("mode " + mode + " is no integer mode");
+		value = TargetValue.wrap(value, bits, mode.isFoldSigned());
+		Map<Long, Integer> values = constants.get(modeId);
+		Integer existing = values.get(value);
+		if (existing != null && replacement[existing] < 0)
+			return existing;
+
+		int node = allocateNode(CONST, -1, modeId, 0);
+		longValues[node] = value;
+		hasLongValue[node] = true;
+		values.put(value, node);
+		return node;
+	}
+
+	/** opcodes of nodes without attributes, which newNode() can create */
+	private static final ir_opcode[] SIMPLE_OPCODES = {
+		ir_opcode.iro_Add, ir_opcode.iro_Sub, ir_opcode.iro_Mul,
+		ir_opcode.iro_Mulh, ir_opcode.iro_And, ir_opcode.iro_Or,
+		ir_opcode.iro_Eor, ir_opcode.iro_Not, ir_opcode.iro_Minus,
+		ir_opcode.iro_Shl, ir_opcode.iro_Shr, ir_opcode.iro_Shrs,
+		ir_opcode.iro_Rotl, ir_opcode.iro_Carry, ir_opcode.iro_Borrow,
+		ir_opcode.iro_Mux,
+	};
+
+	private static Pointer getOp(ir_opcode opcode) {
+		switch (opcode) {
+		case iro_Add:    return binding_ircons.get_op_Add();
+		case iro_Sub:    return binding_ircons.get_op_Sub();
+		case iro_Mul:    return binding_ircons.get_op_Mul();
+		case iro_Mulh:   return binding_ircons.get_op_Mulh();
+		case iro_And:    return binding_ircons.get_op_And();
+		case iro_Or:     return binding_ircons.get_op_Or();
+		case iro_Eor:    return binding_ircons.get_op_Eor();
+		case iro_Not:    return binding_ircons.get_op_Not();
+		case iro_Minus:  return binding_ircons.get_op_Minus();
+		case iro_Shl:    return binding_ircons.get_op_Shl();
+		case iro_Shr:    return binding_ircons.get_op_Shr();
+		case iro_Shrs:   return binding_ircons.get_op_Shrs();
+		case iro_Rotl:   return binding_ircons.get_op_Rotl();
+		case iro_Carry:  return binding_ircons.get_op_Carry();
+		case iro_Borrow: return binding_ircons.get_op_Borrow();
+		case iro_Mux:    return binding_ircons.get_op_Mux();
+		default:         return null;
+		}
+	}
+
+	/**
+	 * creates a new node. Only opcodes without attributes (arithmetic,
+	 * bit operations, shifts and Mux) are supported, use newConst() for
+	 * constants.
+	 */
+	public int newNode(ir_opcode opcode, int block, int modeId, int... ins) {
+		if (!Arrays.asList(SIMPLE_OPCODES).contains(opcode))
+			throw new IllegalArgumentException("can't create " + opcode + " nodes");
+		int node = allocateNode(opcode.val, find(block), modeId, ins.length);
+		for (int i = 0; i < ins.length; ++i) {
+			int pred = find(ins[i]);
+			preds[predStart[node] + i] = pred;
+			addUser(pred, node);
+		}
+		push(node);
+		return node;
+	}
+
+	/** creates the firm node for a (new) node if it doesn't exist yet */
+	private Pointer materialize(int node) {
+		node = find(node);
+		if (pointers[node] != null)
+			return pointers[node];
+
+		Mode mode = modeTable.get(modes[node]);
+		Pointer result;
+		if (opcodes[node] == CONST) {
+			TargetValue value = TargetValue.fromLong(longValues[node], mode);
+			result = binding_ircons.new_r_Const(graph.ptr, value.ptr);
+		} else {
+			int arity = predCount[node];
+			Pointer[] ins = new Pointer[arity];
+			for (int i = 0; i < arity; ++i) {
+				ins[i] = materialize(preds[predStart[node] + i]);
+			}
+			Pointer block = materialize(blocks[node]);
+			ByteBuffer buffer = Node.getPointerBuffer(arity);
+			for (int i = 0; i < arity; ++i) {
+				Node.putPointer(buffer, i, ins[i]);
+			}
+			Pointer op = getOp(ir_opcode.getEnum(opcodes[node]));
+			result = binding_irnode.new_ir_node(Pointer.NULL, graph.ptr, block, op, mode.ptr, arity, buffer);
+		}
+		pointers[node] = result;
+		return result;
+	}
+
+	/** applies the recorded changes to the firm graph */
+	private void commit() {
+		pointers = new Pointer[size];
+		for (int idx = 0; idx < view.size; ++idx) {
+			pointers[idx] = view.getPointer(idx);
+		}
+
+		for (int i = 0; i < nSetPreds; ++i) {
+			int node = setPredNodes[i];
+			if (replacement[node] >= 0)
+				continue;
+			int pos = setPredPositions[i];
+			binding_irnode.set_irn_n(pointers[node], pos, materialize(preds[predStart[node] + pos]));
+		}
+		for (int idx = 0; idx < view.size; ++idx) {
+			if (replacement[idx] < 0 || pointers[idx] == null)
+				continue;
+			binding_irgmod.exchange(pointers[idx], materialize(idx));
+		}
+
+		NodeCache.clear(graph.ptr);
+		binding_irgraph.set_irg_outs_inconsistent(graph.ptr);
+	}
+}
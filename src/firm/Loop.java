@@ -0,0 +1,56 @@
+package firm;
+
+import com.sun.jna.Pointer;
+
+import firm.bindings.binding_irloop;
+import firm.nodes.Node;
+
+/**
+ * A loop of the loop nesting forest of a graph (see LoopTree).
+ */
+public class Loop extends JNAWrapper {
+
+	public Loop(Pointer ptr) {
+		super(ptr);
+	}
+
+	/** returns the nesting depth of the loop (0 for the outermost loop) */
+	public int getDepth() {
+		return binding_irloop.get_loop_depth(ptr);
+	}
+
+	/** returns the surrounding loop, the loop itself if it is outermost */
+	public Loop getOuterLoop() {
+		return new Loop(binding_irloop.get_loop_outer_loop(ptr));
+	}
+
+	/** returns the number of inner loops */
+	public int getNSons() {
+		return binding_irloop.get_loop_n_sons(ptr);
+	}
+
+	/** returns the n-th inner loop */
+	public Loop getSon(int n) {
+		return new Loop(binding_irloop.get_loop_son(ptr, n));
+	}
+
+	/** returns the number of nodes directly contained in the loop */
+	public int getNNodes() {
+		return binding_irloop.get_loop_n_nodes(ptr);
+	}
+
+	/** returns the n-th node directly contained in the loop */
+	public Node getNode(int n) {
+		return Node.createWrapper(binding_irloop.get_loop_node(ptr, n));
+	}
+
+	/** returns a number identifying the loop (for debug output) */
+	public int getLoopNr() {
+		return binding_irloop.get_loop_loop_nr(ptr);
+	}
+
+	@Override
+	public String toString() {
+		return "Loop " + getLoopNr() + " (depth " + getDepth() + ")";
+	}
+}
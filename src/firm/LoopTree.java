@@ -0,0 +1,175 @@
+package firm;
+
+import java.util.Arrays;
+
+import com.sun.jna.Pointer;
+
+import firm.bindings.binding_irloop;
+import firm.nodes.Block;
+
+/**
+ * The control flow loop nesting forest of a graph (construct_cf_backedges),
+ * exported into arrays: the loops are numbered in preorder (so the root
+ * loop has number 0 and inner loops come after their outer loops) and the
+ * loop and loop depth of every block are stored in arrays indexed by block
+ * idx (see Node.getIdx()). The arrays are a snapshot like GraphView.
+ */
+public final class LoopTree {
+
+	/** the graph */
+	public final Graph graph;
+
+	/** number of node indices (see GraphView.size) */
+	public final int size;
+
+	/** the maximal loop depth */
+	public final int maxDepth;
+
+	/** the loops in preorder */
+	public final Loop[] loops;
+
+	/** depth of the loops */
+	public final int[] loopDepth;
+
+	/** number of the surrounding loop of the loops, -1 for the root */
+	public final int[] loopParent;
+
+	/** number of the innermost loop containing a block, -1 for other nodes */
+	public final int[] blockLoop;
+
+	/** loop depth of the blocks (0 outside of loops), -1 for other nodes */
+	public final int[] blockDepth;
+
+	private final NodeIndex blocks;
+
+	LoopTree(Graph graph) {
+		this.graph = graph;
+		maxDepth = binding_irloop.construct_cf_backedges(graph.ptr);
+
+		blocks = new NodeIndex(graph);
+		size = blocks.size;
+		blockLoop = new int[size];
+		blockDepth = new int[size];
+		Arrays.fill(blockLoop, -1);
+		Arrays.fill(blockDepth, -1);
+
+		Pointer root = binding_irloop.get_irg_loop(graph.ptr);
+		Pointer[] loopList = new Pointer[16];
+		int[] depthList = new int[16];
+		int[] parentList = new int[16];
+		int nLoops = 0;
+
+		/* preorder traversal with an explicit stack of (loop number, next son) */
+		int[] stack = new int[16];
+		int[] nextSon = new int[16];
+		int sp = 0;
+		if (root != null) {
+			loopList[0] = root;
+			depthList[0] = binding_irloop.get_loop_depth(root);
+			parentList[0] = -1;
+			nLoops = 1;
+			addBlocks(root, 0, depthList[0]);
+			stack[0] = 0;
+			nextSon[0] = 0;
+			sp = 1;
+		}
+		while (sp > 0) {
+			int nr = stack[sp - 1];
+			Pointer loop = loopList[nr];
+			if (nextSon[sp - 1] >= binding_irloop.get_loop_n_sons(loop)) {
+				--sp;
+				continue;
+			}
+			Pointer son = binding_irloop.get_loop_son(loop, nextSon[sp - 1]++);
+
+			if (nLoops == loopList.length) {
+				loopList = Arrays.copyOf(loopList, nLoops * 2);
+				depthList = Arrays.copyOf(depthList, nLoops * 2);
+				parentList = Arrays.copyOf(parentList, nLoops * 2);
+			}
+			int sonNr = nLoops++;
+			loopList[sonNr] = son;
+			depthList[sonNr] = binding_irloop.get_loop_depth(son);
+			parentList[sonNr] = nr;
+			addBlocks(son, sonNr, depthList[sonNr]);
+
+			if (sp == stack.length) {
+				stack = Arrays.copyOf(stack, sp * 2);
+				nextSon = Arrays.copyOf(nextSon, sp * 2);
+			}
+			stack[sp] = sonNr;
+			nextSon[sp] = 0;
+			++sp;
+		}
+
+		loops = new Loop[nLoops];
+		for (int i = 0; i < nLoops; ++i) {
+			loops[i] = new Loop(loopList[i]);
+		}
+		loopDepth = Arrays.copyOf(depthList, nLoops);
+		loopParent = Arrays.copyOf(parentList, nLoops);
+	}
+
+	private void addBlocks(Pointer loop, int nr, int depth) {
+		int n = binding_irloop.get_loop_n_nodes(loop);
+		for (int i = 0; i < n; ++i) {
+			int idx = blocks.add(binding_irloop.get_loop_node(loop, i));
+			if (idx >= size)
+				continue;
+			blockLoop[idx] = nr;
+			blockDepth[idx] = depth;
+		}
+	}
+
+	/** returns the outermost loop or null if no loop tree was constructed */
+	public Loop getRoot() {
+		return loops.length > 0 ? loops[0] : null;
+	}
+
+	/** returns the innermost loop containing a block or null */
+	public Loop getLoop(Block block) {
+		int idx = block.getIdx();
+		if (idx >= size || blockLoop[idx] < 0)
+			return null;
+		return loops[blockLoop[idx]];
+	}
+
+	/** returns the loop depth of a block (-1 if unknown) */
+	public int getDepth(Block block) {
+		int idx = block.getIdx();
+		return idx < size ? blockDepth[idx] : -1;
+	}
+
+	/**
+	 * returns the idx of all blocks sorted by decreasing loop depth, so
+	 * blocks of the innermost loops come first
+	 */
+	public int[] getBlocksInnermostFirst() {
+		/* counting sort by depth */
+		int[] count = new int[maxDepth + 2];
+		int n = 0;
+		for (int idx = 0; idx < size; ++idx) {
+			if (blockDepth[idx] < 0)
+				continue;
+			++count[maxDepth - Math.min(blockDepth[idx], maxDepth)];
+			++n;
+		}
+		for (int i = 0, pos = 0; i < count.length; ++i) {
+			int c = count[i];
+			count[i] = pos;
+			pos += c;
+		}
+		int[] result = new int[n];
+		for (int idx = 0; idx < size; ++idx) {
+			if (blockDepth[idx] < 0)
+				continue;
+			result[count[maxDepth - Math.min(blockDepth[idx], maxDepth)]++] = idx;
+		}
+		return result;
+	}
+
+	/** returns the wrapper object for the block with the given idx or null */
+	public Block getBlock(int idx) {
+		return blocks.getBlock(idx);
+	}
+}
@@ -1,7 +1,12 @@
 package firm;
 
+import java.util.HashMap;
+import java.util.Map;
+
+import com.sun.jna.NativeLong;
 import com.sun.jna.Pointer;
 
+import firm.bindings.EnumLookup;
 import firm.bindings.binding_irmode;
 
 /**
@@ -15,10 +20,65 @@ import firm.bindings.binding_irmode;
  */
 public final class Mode extends JNAWrapper {
 	
-	public Mode(Pointer p) {
+	/** use createWrapper(), so there is only one Mode object per firm mode */
+	private Mode(Pointer p) {
 		super(p);
 	}
 	
+	/** canonical wrapper objects, one per firm mode */
+	private static final Map<Pointer, Mode> modes = new HashMap<Pointer, Mode>();
+	
+	/** the predefined modes indexed by ir_modecode, filled on first use */
+	private static Mode[] predefined;
+	
+	/**
+	 * returns the canonical Mode object for a firm mode. All modes returned
+	 * by jFirm functions are canonical, so they may be compared with ==.
+	 */
+	public static Mode createWrapper(Pointer ptr) {
+		Mode mode = modes.get(ptr);
+		if (mode == null) {
+			mode = new Mode(ptr);
+			modes.put(ptr, mode);
+		}
+		return mode;
+	}
+	
+	/** forget all mode objects, modes are invalid after Firm.finish() */
+	static void clearCache() {
+		modes.clear();
+		predefined = null;
+	}
+	
+	private static Mode[] getPredefined() {
+		if (predefined == null) {
+			Mode[] table = new Mode[ir_modecode.irm_max.val];
+			table[ir_modecode.irm_BB.val]  = createWrapper(binding_irmode.get_modeBB());
+			table[ir_modecode.irm_X.val]   = createWrapper(binding_irmode.get_modeX());
+			table[ir_modecode.irm_F.val]   = createWrapper(binding_irmode.get_modeF());
+			table[ir_modecode.irm_D.val]   = createWrapper(binding_irmode.get_modeD());
+			table[ir_modecode.irm_E.val]   = createWrapper(binding_irmode.get_modeE());
+			table[ir_modecode.irm_Bs.val]  = createWrapper(binding_irmode.get_modeBs());
+			table[ir_modecode.irm_Bu.val]  = createWrapper(binding_irmode.get_modeBu());
+			table[ir_modecode.irm_Hs.val]  = createWrapper(binding_irmode.get_modeHs());
+			table[ir_modecode.irm_Hu.val]  = createWrapper(binding_irmode.get_modeHu());
+			table[ir_modecode.irm_Is.val]  = createWrapper(binding_irmode.get_modeIs());
+			table[ir_modecode.irm_Iu.val]  = createWrapper(binding_irmode.get_modeIu());
+			table[ir_modecode.irm_Ls.val]  = createWrapper(binding_irmode.get_modeLs());
+			table[ir_modecode.irm_Lu.val]  = createWrapper(binding_irmode.get_modeLu());
+			table[ir_modecode.irm_LLs.val] = createWrapper(binding_irmode.get_modeLLs());
+			table[ir_modecode.irm_LLu.val] = createWrapper(binding_irmode.get_modeLLu());
+			table[ir_modecode.irm_P.val]   = createWrapper(binding_irmode.get_modeP());
+			table[ir_modecode.irm_b.val]   = createWrapper(binding_irmode.get_modeb());
+			table[ir_modecode.irm_M.val]   = createWrapper(binding_irmode.get_modeM());
+			table[ir_modecode.irm_T.val]   = createWrapper(binding_irmode.get_modeT());
+			table[ir_modecode.irm_ANY.val] = createWrapper(binding_irmode.get_modeANY());
+			table[ir_modecode.irm_BAD.val] = createWrapper(binding_irmode.get_modeBAD());
+			predefined = table;
+		}
+		return predefined;
+	}
+	
 	public static enum ir_modecode {
 		irm_BB(),
 		irm_X(),
@@ -53,12 +113,10 @@ public final class Mode extends JNAWrapper {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_modecode> lookup = new EnumLookup<ir_modecode>(values());
+
 		public static ir_modecode getEnum(int val) {
-			for(ir_modecode entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_mode_sort_helper {
@@ -77,12 +135,10 @@ public final class Mode extends JNAWrapper {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_mode_sort_helper> lookup = new EnumLookup<ir_mode_sort_helper>(values());
+
 		public static ir_mode_sort_helper getEnum(int val) {
-			for(ir_mode_sort_helper entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_mode_sort {
@@ -104,12 +160,10 @@ public final class Mode extends JNAWrapper {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_mode_sort> lookup = new EnumLookup<ir_mode_sort>(values());
+
 		public static ir_mode_sort getEnum(int val) {
-			for(ir_mode_sort entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_mode_arithmetic {
@@ -132,25 +186,75 @@ public final class Mode extends JNAWrapper {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_mode_arithmetic> lookup = new EnumLookup<ir_mode_arithmetic>(values());
+
 		public static ir_mode_arithmetic getEnum(int val) {
-			for(ir_mode_arithmetic entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	
 	
-	public Mode(String name, ir_mode_sort sort, int bitSize, 
+	/**
+	 * creates a new mode (new_ir_mode). If firm already has an equal mode,
+	 * that mode is returned.
+	 */
+	public static Mode newMode(String name, ir_mode_sort sort, int bitSize,
 			int sign, ir_mode_arithmetic arithmetic, int moduloShift) {
-		this(binding_irmode.new_ir_mode(name, sort.val, bitSize, sign, arithmetic.val, moduloShift));
+		return createWrapper(binding_irmode.new_ir_mode(name, sort.val, bitSize, sign, arithmetic.val, moduloShift));
 	}
 	
-	public Mode(String name, ir_mode_sort sort, 
-			int bitSize, int numOfElem, int sign, ir_mode_arithmetic arithmetic, 
+	/**
+	 * creates a new vector mode (new_ir_vector_mode). If firm already has an
+	 * equal mode, that mode is returned.
+	 */
+	public static Mode newVectorMode(String name, ir_mode_sort sort,
+			int bitSize, int numOfElem, int sign, ir_mode_arithmetic arithmetic,
 			int moduloShift) {
-		this(binding_irmode.new_ir_vector_mode(name, sort.val, bitSize, numOfElem, sign, arithmetic.val, moduloShift));
+		return createWrapper(binding_irmode.new_ir_vector_mode(name, sort.val, bitSize, numOfElem, sign, arithmetic.val, moduloShift));
+	}
+	
+	/**
+	 * bit size used for java-side constant folding of integer values,
+	 * 0 if values of this mode don't fit into a C long (-1: not computed yet)
+	 */
+	private int foldBits = -1;
+	private boolean foldSigned;
+	private int foldModuloShift;
+	
+	private void computeFoldInfo() {
+		int bits = getSizeBits();
+		foldSigned = isSigned();
+		foldModuloShift = getModuloShift();
+		/*
+		 * the values are passed to the tarval module as C long, so they must
+		 * fit into a (signed) NativeLong, which has 32 bits on some platforms
+		 */
+		int nativeBits = NativeLong.SIZE * 8;
+		if (isInt() && getArithmetic() == ir_mode_arithmetic.irma_twos_complement
+				&& (bits < nativeBits || (bits == nativeBits && foldSigned))) {
+			foldBits = bits;
+		} else {
+			foldBits = 0;
+		}
+	}
+	
+	/** see TargetValue: bit size for folding in a long or 0 */
+	final int getFoldBits() {
+		if (foldBits < 0)
+			computeFoldInfo();
+		return foldBits;
+	}
+	
+	final boolean isFoldSigned() {
+		if (foldBits < 0)
+			computeFoldInfo();
+		return foldSigned;
+	}
+	
+	final int getFoldModuloShift() {
+		if (foldBits < 0)
+			computeFoldInfo();
+		return foldModuloShift;
 	}
 	
 	public final String getName() {
@@ -241,108 +345,107 @@ public final class Mode extends JNAWrapper {
 	}
 
 	public static final Mode getF() {
-		Pointer modePtr = binding_irmode.get_modeF();
-		return new Mode(modePtr);
+		return getPredefined()[ir_modecode.irm_F.val];
 	}
 
 	public static final Mode getD() {
-		Pointer modePtr = binding_irmode.get_modeD();
-		return new Mode(modePtr);
+		return getPredefined()[ir_modecode.irm_D.val];
 	}
 
 	public static final Mode getE() {
-		Pointer modePtr = binding_irmode.get_modeE();
-		return new Mode(modePtr);
+		return getPredefined()[ir_modecode.irm_E.val];
 	}
 
 	public static final Mode getBs() {
-		Pointer modePtr = binding_irmode.get_modeBs();
-		return new Mode(modePtr);
+		return getPredefined()[ir_modecode.irm_Bs.val];
 	}
 
 	public static final Mode getBu() {
-		Pointer modePtr = binding_irmode.get_modeBu();
-		return new Mode(modePtr);
+		return getPredefined()[ir_modecode.irm_Bu.val];
 	}
 
 	public static final Mode getHs() {
-		Pointer modePtr = binding_irmode.get_modeHs();
-		return new Mode(modePtr);
+		return getPredefined()[ir_modecode.irm_Hs.val];
 	}
 
 	public static final Mode getHu() {
-		Pointer modePtr = binding_irmode.get_modeHu();
-		return new Mode(modePtr);
+		return getPredefined()[ir_modecode.irm_Hu.val];
 	}
 
 	public static final Mode getIs() {
-		Pointer modePtr = binding_irmode.get_modeIs();
-		return new Mode(modePtr);
+		return getPredefined()[ir_modecode.irm_Is.val];
 	}
 
 	public static final Mode getIu() {
-		Pointer modePtr = binding_irmode.get_modeIu();
-		return new Mode(modePtr);
+		return getPredefined()[ir_modecode.irm_Iu.val];
 	}
 
 	public static final Mode getLs() {
-		Pointer modePtr = binding_irmode.get_modeLs();
-		return new Mode(modePtr);
+		return getPredefined()[ir_modecode.irm_Ls.val];
 	}
 
 	public static final Mode getLu() {
-		Pointer modePtr = binding_irmode.get_modeLu();
-		return new Mode(modePtr);
+		return getPredefined()[ir_modecode.irm_Lu.val];
 	}
 
 	public static final Mode getLLs() {
-		Pointer modePtr = binding_irmode.get_modeLLs();
-		return new Mode(modePtr);
+		return getPredefined()[ir_modecode.irm_LLs.val];
 	}
 
 	public static final Mode getLLu() {
-		Pointer modePtr = binding_irmode.get_modeLLu();
-		return new Mode(modePtr);
+		return getPredefined()[ir_modecode.irm_LLu.val];
 	}
 
 	public static final Mode getP() {
-		Pointer modePtr = binding_irmode.get_modeP();
-		return new Mode(modePtr);
+		return getPredefined()[ir_modecode.irm_P.val];
+	}
+
+	/**
+	 * sets the mode used for data pointers (set_modeP_data), which getP()
+	 * returns from then on
+	 */
+	public static final void setPData(Mode mode) {
+		binding_irmode.set_modeP_data(mode.ptr);
+		refreshP();
+	}
+
+	/** sets the mode used for code pointers (set_modeP_code) */
+	public static final void setPCode(Mode mode) {
+		binding_irmode.set_modeP_code(mode.ptr);
+		refreshP();
+	}
+
+	private static void refreshP() {
+		if (predefined != null)
+			predefined[ir_modecode.irm_P.val] = createWrapper(binding_irmode.get_modeP());
 	}
 
 	public static final Mode getb() {
-		Pointer modePtr = binding_irmode.get_modeb();
-		return new Mode(modePtr);
+		return getPredefined()[ir_modecode.irm_b.val];
 	}
 
 	public static final Mode getX() {
-		Pointer modePtr = binding_irmode.get_modeX();
-		return new Mode(modePtr);
+		return getPredefined()[ir_modecode.irm_X.val];
 	}
 
 	public static final Mode getBB() {
-		Pointer modePtr = binding_irmode.get_modeBB();
-		return new Mode(modePtr);
+		return getPredefined()[ir_modecode.irm_BB.val];
 	}
 
 	public static final Mode getM() {
-		Pointer modePtr = binding_irmode.get_modeM();
-		return new Mode(modePtr);
+		return getPredefined()[ir_modecode.irm_M.val];
 	}
 
 	public static final Mode getT() {
-		Pointer modePtr = binding_irmode.get_modeT();
-		return new Mode(modePtr);
+		return getPredefined()[ir_modecode.irm_T.val];
 	}
 
 	public static final Mode getANY() {
-		Pointer modePtr = binding_irmode.get_modeANY();
-		return new Mode(modePtr);
+		return getPredefined()[ir_modecode.irm_ANY.val];
 	}
 
 	public static final Mode getBAD() {
-		Pointer modePtr = binding_irmode.get_modeBAD();
-		return new Mode(modePtr);
+		return getPredefined()[ir_modecode.irm_BAD.val];
 	}
 
 	public final boolean isSigned() {
@@ -397,17 +500,17 @@ public final class Mode extends JNAWrapper {
 	
 	public final Mode findUnsigned() {
 		Pointer modep = binding_irmode.find_unsigned_mode(ptr);
-		return new Mode(modep);
+		return createWrapper(modep);
 	}
 	
 	public final Mode findSigned() {
 		Pointer modep = binding_irmode.find_signed_mode(ptr);
-		return new Mode(modep);
+		return createWrapper(modep);
 	}
 	
 	public final Mode findDoubleBitsInt() {
 		Pointer modep = binding_irmode.find_double_bits_int_mode(ptr);
-		return new Mode(modep);
+		return createWrapper(modep);
 	}
 	
 	public final boolean honorSignedZeros() {
@@ -424,7 +527,7 @@ public final class Mode extends JNAWrapper {
 
 	public final Mode getReferenceSignedEq() {
 		Pointer modep = binding_irmode.get_reference_mode_signed_eq(ptr);
-		return new Mode(modep);
+		return createWrapper(modep);
 	}
 
 	public final void setReferenceSignedEq(Mode intMode) {
@@ -433,7 +536,7 @@ public final class Mode extends JNAWrapper {
 	
 	public final Mode getReferenceUnsignedEq() {
 		Pointer modep = binding_irmode.get_reference_mode_unsigned_eq(ptr);
-		return new Mode(modep);
+		return createWrapper(modep);
 	}
 
 	public final void setReferenceUnsignedEq(Mode intMode) {
@@ -0,0 +1,80 @@
+package firm;
+
+import com.sun.jna.Pointer;
+
+import firm.bindings.binding_irgwalk;
+import firm.bindings.binding_irnode;
+import firm.nodes.Block;
+import firm.nodes.Node;
+
+/**
+ * The native nodes of a graph by idx (see Node.getIdx()). This is the part
+ * shared by the analysis results exported into idx-indexed arrays
+ * (DominatorTree, LoopTree, OutEdges, ValueRanges, ExtendedBlocks).
+ *
+ * Like GraphView these results are snapshots: they are not updated when the
+ * graph changes, nodes created later have indices >= size. Compute them
+ * again after modifying the graph.
+ */
+final class NodeIndex {
+
+	/** number of node indices (Graph.getLastIdx() at the time of creation) */
+	final int size;
+
+	private final Pointer[] nodes;
+
+	/** creates an empty index, add nodes with add() */
+	NodeIndex(Graph graph) {
+		size = graph.getLastIdx();
+		nodes = new Pointer[size];
+	}
+
+	/** collects all nodes reachable from the end node (irg_walk_graph) */
+	static NodeIndex collectNodes(Graph graph) {
+		NodeIndex index = new NodeIndex(graph);
+		binding_irgwalk.irg_walk_graph(graph.ptr, index.collector(), null, Pointer.NULL);
+		return index;
+	}
+
+	/** collects all blocks reachable from the end node (irg_block_walk_graph) */
+	static NodeIndex collectBlocks(Graph graph) {
+		NodeIndex index = new NodeIndex(graph);
+		binding_irgwalk.irg_block_walk_graph(graph.ptr, index.collector(), null, Pointer.NULL);
+		return index;
+	}
+
+	private binding_irgwalk.irg_walk_func collector() {
+		return new binding_irgwalk.irg_walk_func() {
+			@Override
+			public void callback(Pointer node, Pointer env) {
+				add(node);
+			}
+		};
+	}
+
+	/** adds a node and returns its idx (nodes with idx >= size are not stored) */
+	int add(Pointer node) {
+		int idx = binding_irnode.get_irn_idx(node);
+		if (idx < size)
+			nodes[idx] = node;
+		return idx;
+	}
+
+	/** returns the native node with the given idx or null */
+	Pointer get(int idx) {
+		if (idx < 0 || idx >= size)
+			return null;
+		return nodes[idx];
+	}
+
+	/** returns the wrapper object for the node with the given idx or null */
+	Node getNode(int idx) {
+		Pointer node = get(idx);
+		return node == null ? null : Node.createWrapper(node);
+	}
+
+	/** returns the wrapper object for the block with the given idx or null */
+	Block getBlock(int idx) {
+		return (Block) getNode(idx);
+	}
+}
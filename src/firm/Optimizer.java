@@ -0,0 +1,300 @@
+package firm;
+
+import java.util.HashMap;
+import java.util.Map;
+
+import com.sun.jna.Pointer;
+
+import firm.bindings.binding_irflag;
+import firm.bindings.binding_irgopt;
+import firm.bindings.binding_irgraph;
+import firm.bindings.binding_iroptimize;
+import firm.bindings.binding_iroptimize.osr_flags;
+import firm.nodes.NodeCache;
+
+/**
+ * Runs the libfirm optimizations (binding_iroptimize) in fixed pipelines.
+ * The pipelines trade compile time for code quality like the -O switches
+ * of a C compiler:
+ * <ul>
+ * <li>O0: no optimizations</li>
+ * <li>O1: cheap local and control flow optimizations</li>
+ * <li>O2: adds scalar replacement, combo, reassociation, GVN-PRE, code
+ *     placement and load/store optimization</li>
+ * <li>O3: adds inlining, loop optimizations, strength reduction and
+ *     if-conversion</li>
+ * </ul>
+ * Local optimizations (set_optimize) are switched on while a pipeline runs
+ * and restored to their previous state afterwards, Firm.init() switches
+ * them off.
+ */
+public final class Optimizer {
+
+	/** optimization levels */
+	public static enum Level {
+		O0, O1, O2, O3;
+
+		/** parses "0".."3", "O0".."O3" or "-O0".."-O3" */
+		public static Level fromString(String level) {
+			String name = level.startsWith("-") ? level.substring(1) : level;
+			if (!name.startsWith("O"))
+				name = "O" + name;
+			try {
+				return valueOf(name);
+			} catch (IllegalArgumentException e) {
+				throw new IllegalArgumentException("Unknown optimization level '" + level + "'");
+			}
+		}
+	}
+
+	/** the optimizations which work on a single graph */
+	public static enum GraphOptimization {
+		LOCAL {
+			@Override
+			public void run(Graph graph) {
+				binding_irgopt.optimize_graph_df(graph.ptr);
+			}
+		},
+		CONTROL_FLOW {
+			@Override
+			public void run(Graph graph) {
+				binding_iroptimize.optimize_cf(graph.ptr);
+			}
+		},
+		TAIL_RECURSION {
+			@Override
+			public void run(Graph graph) {
+				binding_iroptimize.opt_tail_rec_irg(graph.ptr);
+			}
+		},
+		LOAD_STORE {
+			@Override
+			public void run(Graph graph) {
+				binding_iroptimize.optimize_load_store(graph.ptr);
+			}
+		},
+		SCALAR_REPLACEMENT {
+			@Override
+			public void run(Graph graph) {
+				binding_iroptimize.scalar_replacement_opt(graph.ptr);
+			}
+		},
+		COMBO {
+			@Override
+			public void run(Graph graph) {
+				binding_iroptimize.combo(graph.ptr);
+			}
+		},
+		REASSOCIATION {
+			@Override
+			public void run(Graph graph) {
+				binding_iroptimize.optimize_reassociation(graph.ptr);
+			}
+		},
+		CONV {
+			@Override
+			public void run(Graph graph) {
+				binding_iroptimize.conv_opt(graph.ptr);
+			}
+		},
+		GVN_PRE {
+			@Override
+			public void run(Graph graph) {
+				binding_iroptimize.do_gvn_pre(graph.ptr);
+			}
+		},
+		PLACE_CODE {
+			@Override
+			public void run(Graph graph) {
+				binding_iroptimize.place_code(graph.ptr);
+			}
+		},
+		LDST {
+			@Override
+			public void run(Graph graph) {
+				binding_iroptimize.opt_ldst(graph.ptr);
+			}
+		},
+		BOOL {
+			@Override
+			public void run(Graph graph) {
+				binding_iroptimize.opt_bool(graph.ptr);
+			}
+		},
+		JUMP_THREADING {
+			@Override
+			public void run(Graph graph) {
+				binding_iroptimize.opt_jumpthreading(graph.ptr);
+			}
+		},
+		OSR {
+			@Override
+			public void run(Graph graph) {
+				binding_iroptimize.opt_osr(graph.ptr, osr_flags.osr_flag_keep_reg_pressure.val);
+			}
+		},
+		LOOP {
+			@Override
+			public void run(Graph graph) {
+				binding_iroptimize.loop_optimization(graph.ptr);
+			}
+		},
+		IF_CONVERSION {
+			@Override
+			public void run(Graph graph) {
+				binding_iroptimize.opt_if_conv(graph.ptr);
+			}
+		},
+		FRAME {
+			@Override
+			public void run(Graph graph) {
+				binding_iroptimize.opt_frame_irg(graph.ptr);
+			}
+		};
+
+		public abstract void run(Graph graph);
+	}
+
+	private static final GraphOptimization[] O1_PIPELINE = {
+		GraphOptimization.LOCAL,
+		GraphOptimization.CONTROL_FLOW,
+		GraphOptimization.TAIL_RECURSION,
+		GraphOptimization.LOAD_STORE,
+		GraphOptimization.CONTROL_FLOW,
+	};
+
+	private static final GraphOptimization[] O2_PIPELINE = {
+		GraphOptimization.SCALAR_REPLACEMENT,
+		GraphOptimization.LOCAL,
+		GraphOptimization.CONTROL_FLOW,
+		GraphOptimization.COMBO,
+		GraphOptimization.TAIL_RECURSION,
+		GraphOptimization.REASSOCIATION,
+		GraphOptimization.CONV,
+		GraphOptimization.GVN_PRE,
+		GraphOptimization.PLACE_CODE,
+		GraphOptimization.LDST,
+		GraphOptimization.BOOL,
+		GraphOptimization.LOCAL,
+		GraphOptimization.CONTROL_FLOW,
+		GraphOptimization.FRAME,
+	};
+
+	private static final GraphOptimization[] O3_PIPELINE = {
+		GraphOptimization.SCALAR_REPLACEMENT,
+		GraphOptimization.LOCAL,
+		GraphOptimization.CONTROL_FLOW,
+		GraphOptimization.COMBO,
+		GraphOptimization.TAIL_RECURSION,
+		GraphOptimization.JUMP_THREADING,
+		GraphOptimization.LOOP,
+		GraphOptimization.OSR,
+		GraphOptimization.REASSOCIATION,
+		GraphOptimization.CONV,
+		GraphOptimization.GVN_PRE,
+		GraphOptimization.PLACE_CODE,
+		GraphOptimization.LDST,
+		GraphOptimization.BOOL,
+		GraphOptimization.IF_CONVERSION,
+		GraphOptimization.LOCAL,
+		GraphOptimization.CONTROL_FLOW,
+		GraphOptimization.FRAME,
+	};
+
+	/** maximal size of a function after inlining (O3) */
+	private static final int INLINE_MAX_SIZE = 750;
+	/** inlining benefit threshold (O3) */
+	private static final int INLINE_THRESHOLD = 0;
+
+	/**
+	 * This class only contains static functions,
+	 * creating an instance makes no sense
+	 */
+	private Optimizer() {
+	}
+
+	/** returns the graph optimizations of a level in the order they run */
+	public static GraphOptimization[] getPipeline(Level level) {
+		switch (level) {
+		case O0: return new GraphOptimization[0];
+		case O1: return O1_PIPELINE.clone();
+		case O2: return O2_PIPELINE.clone();
+		case O3: return O3_PIPELINE.clone();
+		}
+		throw new IllegalArgumentException("Unknown optimization level " + level);
+	}
+
+	/**
+	 * runs a list of graph optimizations on a graph. The node wrapper cache
+	 * of the graph is cleared afterwards, the optimizations exchange nodes.
+	 */
+	public static void run(Graph graph, GraphOptimization... pipeline) {
+		if (pipeline.length == 0)
+			return;
+		int oldOptimize = binding_irflag.get_optimize();
+		binding_irflag.set_optimize(1);
+		try {
+			for (GraphOptimization optimization : pipeline) {
+				optimization.run(graph);
+			}
+		} finally {
+			binding_irflag.set_optimize(oldOptimize);
+			graph.clearNodeCache();
+		}
+	}
+
+	/** optimizes a single graph */
+	public static void optimize(Graph graph, Level level) {
+		run(graph, getPipeline(level));
+	}
+
+	/**
+	 * optimizes the whole program: runs the graph pipeline of the level on
+	 * every graph. O3 then inlines functions, runs the O1 pipeline on every
+	 * graph again to clean up and removes unused entities.
+	 */
+	public static void optimize(Level level) {
+		if (level == Level.O0)
+			return;
+
+		GraphOptimization[] pipeline = getPipeline(level);
+		for (Graph graph : Program.getGraphs()) {
+			run(graph, pipeline);
+		}
+
+		if (level == Level.O3) {
+			int oldOptimize = binding_irflag.get_optimize();
+			binding_irflag.set_optimize(1);
+			try {
+				binding_iroptimize.inline_functions(INLINE_MAX_SIZE, INLINE_THRESHOLD, Pointer.NULL);
+			} finally {
+				binding_irflag.set_optimize(oldOptimize);
+			}
+			/* clean up after inlining */
+			for (Graph graph : Program.getGraphs()) {
+				run(graph, O1_PIPELINE);
+			}
+			garbageCollectEntities();
+		}
+	}
+
+	/**
+	 * runs garbage_collect_entities and drops the cached wrappers of the
+	 * graphs it freed and of their frame types, their addresses may be
+	 * reused
+	 */
+	private static void garbageCollectEntities() {
+		Map<Pointer, Pointer> frameTypes = new HashMap<Pointer, Pointer>();
+		for (Graph graph : Program.getGraphs()) {
+			frameTypes.put(graph.ptr, binding_irgraph.get_irg_frame_type(graph.ptr));
+		}
+		binding_iroptimize.garbage_collect_entities();
+		for (Graph graph : Program.getGraphs()) {
+			frameTypes.remove(graph.ptr);
+		}
+		for (Map.Entry<Pointer, Pointer> freed : frameTypes.entrySet()) {
+			NodeCache.disable(freed.getKey());
+			Type.forget(freed.getValue());
+		}
+	}
+}
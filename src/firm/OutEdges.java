@@ -0,0 +1,110 @@
+package firm;
+
+import com.sun.jna.Pointer;
+
+import firm.bindings.binding_irnode;
+import firm.bindings.binding_irouts;
+import firm.nodes.Node;
+
+/**
+ * The users (out edges) of all nodes of a graph in compressed sparse row
+ * form, indexed by node idx (see Node.getIdx()). The users of node i are
+ * users[outStart[i]] .. users[outStart[i+1] - 1], the input position at
+ * which they use node i is stored in the same place in userPositions.
+ *
+ * The index is built from the irouts data structure (compute_irg_outs) in
+ * a single graph walk, so unlike BackEdges it does not need activated edges
+ * and produces no objects per edge. The index is a snapshot like GraphView.
+ */
+public final class OutEdges {
+
+	/** the graph the out edges belong to */
+	public final Graph graph;
+
+	/** number of node indices (see GraphView.size) */
+	public final int size;
+
+	/** start of the user list of each node in users (length size + 1) */
+	public final int[] outStart;
+
+	/** idx of the users of all nodes (see outStart) */
+	public final int[] users;
+
+	/** input position of the edges in users */
+	public final int[] userPositions;
+
+	private final NodeIndex nodes;
+
+	OutEdges(Graph graph) {
+		this.graph = graph;
+
+		binding_irouts.assure_irg_outs(graph.ptr);
+		nodes = NodeIndex.collectNodes(graph);
+		size = nodes.size;
+
+		outStart = new int[size + 1];
+		int nEdges = 0;
+		for (int idx = 0; idx < size; ++idx) {
+			outStart[idx] = nEdges;
+			Pointer node = nodes.get(idx);
+			if (node != null)
+				nEdges += binding_irouts.get_irn_n_outs(node);
+		}
+		outStart[size] = nEdges;
+
+		users = new int[nEdges];
+		userPositions = new int[nEdges];
+		int[] inPos = new int[1];
+		for (int idx = 0; idx < size; ++idx) {
+			Pointer node = nodes.get(idx);
+			for (int i = 0, pos = outStart[idx]; pos < outStart[idx + 1]; ++i, ++pos) {
+				Pointer user = binding_irouts.get_irn_out_ex(node, i, inPos);
+				users[pos] = binding_irnode.get_irn_idx(user);
+				userPositions[pos] = inPos[0];
+			}
+		}
+	}
+
+	/** returns the number of users of a node */
+	public int getNOuts(int idx) {
+		return outStart[idx + 1] - outStart[idx];
+	}
+
+	/** returns the number of users of a node */
+	public int getNOuts(Node node) {
+		int idx = node.getIdx();
+		if (idx >= size)
+			return 0;
+		return getNOuts(idx);
+	}
+
+	/** returns the idx of the n-th user of a node */
+	public int getUser(int idx, int n) {
+		return users[outStart[idx] + n];
+	}
+
+	/** returns the input position at which the n-th user uses the node */
+	public int getUserPos(int idx, int n) {
+		return userPositions[outStart[idx] + n];
+	}
+
+	/** returns wrapper objects for all users of a node */
+	public Node[] getUsers(Node node) {
+		int idx = node.getIdx();
+		if (idx >= size)
+			return new Node[0];
+		Node[] result = new Node[getNOuts(idx)];
+		for (int i = 0; i < result.length; ++i) {
+			result[i] = getNode(getUser(idx, i));
+		}
+		return result;
+	}
+
+	/**
+	 * returns a wrapper object for the node with the given idx (or null if
+	 * the node was not reachable when the out edges were computed)
+	 */
+	public Node getNode(int idx) {
+		return nodes.getNode(idx);
+	}
+}
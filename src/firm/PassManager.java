@@ -0,0 +1,265 @@
+package firm;
+
+import java.io.Closeable;
+import java.io.PrintStream;
+import java.util.ArrayList;
+import java.util.List;
+
+import com.sun.jna.Memory;
+import com.sun.jna.Native;
+import com.sun.jna.Pointer;
+
+import firm.bindings.binding_irpass;
+
+/**
+ * Runs a pipeline of libfirm passes (irpass.h) over the program and
+ * measures the wall-clock time spent in each pass.
+ *
+ * Passes are created with the *_pass functions of the bindings (for
+ * example binding_iroptimize.opt_ldst_pass(null)) or from java code with
+ * addGraphPass(String, GraphPass). Pass null as name to the *_pass
+ * functions: libfirm keeps the name pointer, and a string passed through
+ * JNA is freed right after the call. With null libfirm uses its static
+ * default name. Graph passes run on every graph of the
+ * program. Each pass gets its own native program pass manager, so the
+ * passes can be timed separately; verification and dumping are done by
+ * libfirm like for a single manager.
+ *
+ * The native managers (and the passes added to them) are released with
+ * close().
+ */
+public class PassManager implements Closeable {
+
+	/** a graph pass implemented in java */
+	public interface GraphPass {
+		void run(Graph graph);
+	}
+
+	/** a program pass implemented in java */
+	public interface ProgramPass {
+		void run();
+	}
+
+	/** a pass of the pipeline with its own native manager */
+	private static final class Entry {
+		final String name;
+		final Pointer mgr;
+		/* keeps the callback and the native name of java passes alive */
+		final Object callback;
+		final Memory nativeName;
+		long time;
+		int runs;
+
+		Entry(String name, Pointer mgr, Object callback, Memory nativeName) {
+			this.name = name;
+			this.mgr = mgr;
+			this.callback = callback;
+			this.nativeName = nativeName;
+		}
+	}
+
+	private final String name;
+	/** libfirm keeps the name pointer, so it lives as long as the managers */
+	private final Memory nativeName;
+	private final boolean verifyAll;
+	private final boolean dumpAll;
+	private final List<Entry> entries = new ArrayList<Entry>();
+	private boolean closed;
+	/** first exception thrown by a java pass (can't propagate through libfirm) */
+	private Throwable failure;
+
+	/**
+	 * creates an empty pass manager
+	 * @param name       name of the manager (used for dump files)
+	 * @param verifyAll  verify the graphs after each pass
+	 * @param dumpAll    dump the graphs after each pass
+	 */
+	public PassManager(String name, boolean verifyAll, boolean dumpAll) {
+		this.name = name;
+		this.nativeName = toNative(name);
+		this.verifyAll = verifyAll;
+		this.dumpAll = dumpAll;
+	}
+
+	public PassManager(String name) {
+		this(name, false, false);
+	}
+
+	private void checkOpen() {
+		if (closed)
+			throw new IllegalStateException("PassManager already closed");
+	}
+
+	/** copies a string to native memory (null terminated) */
+	private static Memory toNative(String string) {
+		byte[] bytes = Native.toByteArray(string);
+		Memory memory = new Memory(bytes.length);
+		memory.write(0, bytes, 0, bytes.length);
+		return memory;
+	}
+
+	private Pointer newManager() {
+		Pointer mgr = binding_irpass.new_prog_pass_mgr(nativeName, verifyAll ? 1 : 0, dumpAll ? 1 : 0);
+		binding_irpass.ir_prog_pass_mgr_set_run_idx(mgr, entries.size());
+		return mgr;
+	}
+
+	/**
+	 * adds a native graph pass (ir_graph_pass_t) which is run on all graphs
+	 * @param passName  name shown in the timings
+	 * @param pass      the pass, the manager takes ownership. Create it with
+	 *                  a null name (see class comment).
+	 * @param parallel  allow libfirm to run the pass on several graphs in
+	 *                  parallel (ir_graph_pass_set_parallel)
+	 */
+	public void addGraphPass(String passName, Pointer pass, boolean parallel) {
+		checkOpen();
+		binding_irpass.ir_graph_pass_set_parallel(pass, parallel ? 1 : 0);
+		Pointer mgr = newManager();
+		binding_irpass.ir_prog_pass_mgr_add_graph_pass(mgr, pass);
+		entries.add(new Entry(passName, mgr, null, null));
+	}
+
+	/** adds a native graph pass which is run on one graph after another */
+	public void addGraphPass(String passName, Pointer pass) {
+		addGraphPass(passName, pass, false);
+	}
+
+	/** adds a native program pass (ir_prog_pass_t, created with a null name) */
+	public void addProgramPass(String passName, Pointer pass) {
+		checkOpen();
+		Pointer mgr = newManager();
+		binding_irpass.ir_prog_pass_mgr_add(mgr, pass);
+		entries.add(new Entry(passName, mgr, null, null));
+	}
+
+	/**
+	 * adds a graph pass implemented in java. Java passes are never run in
+	 * parallel.
+	 */
+	public void addGraphPass(String passName, final GraphPass pass) {
+		checkOpen();
+		binding_irpass.graph_func callback = new binding_irpass.graph_func() {
+			@Override
+			public void callback(Pointer irg) {
+				if (failure != null)
+					return;
+				try {
+					pass.run(new Graph(irg));
+				} catch (RuntimeException e) {
+					failure = e;
+				} catch (Error e) {
+					failure = e;
+				}
+			}
+		};
+		Memory nativePassName = toNative(passName);
+		Pointer mgr = newManager();
+		binding_irpass.ir_prog_pass_mgr_add_graph_pass(mgr, binding_irpass.def_graph_pass(nativePassName, callback));
+		entries.add(new Entry(passName, mgr, callback, nativePassName));
+	}
+
+	/** adds a program pass implemented in java */
+	public void addProgramPass(String passName, final ProgramPass pass) {
+		checkOpen();
+		binding_irpass.prog_func callback = new binding_irpass.prog_func() {
+			@Override
+			public void callback() {
+				if (failure != null)
+					return;
+				try {
+					pass.run();
+				} catch (RuntimeException e) {
+					failure = e;
+				} catch (Error e) {
+					failure = e;
+				}
+			}
+		};
+		Memory nativePassName = toNative(passName);
+		Pointer mgr = newManager();
+		binding_irpass.ir_prog_pass_mgr_add(mgr, binding_irpass.def_prog_pass(nativePassName, callback));
+		entries.add(new Entry(passName, mgr, callback, nativePassName));
+	}
+
+	/**
+	 * runs all passes in the order they were added, returns true if any
+	 * pass reported a change. If a java pass throws an exception the
+	 * remaining passes are skipped and the exception is rethrown.
+	 */
+	public boolean run() {
+		checkOpen();
+		boolean changed = false;
+		failure = null;
+		for (Entry entry : entries) {
+			long start = System.nanoTime();
+			if (binding_irpass.ir_prog_pass_mgr_run(entry.mgr) != 0)
+				changed = true;
+			entry.time += System.nanoTime() - start;
+			++entry.runs;
+			if (failure != null) {
+				Throwable t = failure;
+				failure = null;
+				if (t instanceof Error)
+					throw (Error) t;
+				throw (RuntimeException) t;
+			}
+		}
+		return changed;
+	}
+
+	/** returns the number of passes */
+	public int getNPasses() {
+		return entries.size();
+	}
+
+	/** returns the name of the n-th pass */
+	public String getPassName(int n) {
+		return entries.get(n).name;
+	}
+
+	/** returns the wall-clock time spent in the n-th pass in nanoseconds */
+	public long getPassTime(int n) {
+		return entries.get(n).time;
+	}
+
+	/** returns the wall-clock time spent in all passes in nanoseconds */
+	public long getTotalTime() {
+		long total = 0;
+		for (Entry entry : entries) {
+			total += entry.time;
+		}
+		return total;
+	}
+
+	/** resets all timings to 0 */
+	public void resetTimings() {
+		for (Entry entry : entries) {
+			entry.time = 0;
+			entry.runs = 0;
+		}
+	}
+
+	/** prints the time spent in each pass and its share of the total */
+	public void printTimings(PrintStream out) {
+		long total = getTotalTime();
+		out.printf("%s: %.3f ms%n", name, total / 1e6);
+		for (Entry entry : entries) {
+			double percent = total > 0 ? 100.0 * entry.time / total : 0.0;
+			out.printf("  %-30s %10.3f ms %5.1f%% (%d runs)%n",
+			           entry.name, entry.time / 1e6, percent, entry.runs);
+		}
+	}
+
+	/** releases the native managers and passes */
+	@Override
+	public void close() {
+		if (closed)
+			return;
+		for (Entry entry : entries) {
+			binding_irpass.term_prog_pass_mgr(entry.mgr);
+		}
+		entries.clear();
+		closed = true;
+	}
+}
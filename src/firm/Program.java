@@ -28,7 +28,7 @@ public class Program {
 	 * Set name of the currently active program/compilation unit
 	 */
 	public static void setName(String name) {
-		binding_irprog.set_irp_prog_name(new Ident(name).ptr);
+		binding_irprog.set_irp_prog_name(Ident.intern(name).ptr);
 	}
 	
 	/**
@@ -120,7 +120,7 @@ public class Program {
 	}
 	
 	public static Mode getMode(int n) {
-		return new Mode(binding_irprog.get_irp_mode(n));
+		return Mode.createWrapper(binding_irprog.get_irp_mode(n));
 	}
 	
 	public static Iterable<Mode> getModes() {
@@ -0,0 +1,312 @@
+package firm;
+
+import java.io.UnsupportedEncodingException;
+import java.security.MessageDigest;
+import java.security.NoSuchAlgorithmException;
+import java.util.Arrays;
+
+import com.sun.jna.Pointer;
+
+import firm.bindings.binding_ident;
+import firm.bindings.binding_irgraph;
+import firm.bindings.binding_irmode;
+import firm.bindings.binding_irnode;
+import firm.bindings.binding_irnode.ir_opcode;
+import firm.bindings.binding_irnode.symconst_kind;
+import firm.bindings.binding_tv;
+import firm.bindings.binding_typerep;
+import firm.bindings.binding_typerep.tp_opcode;
+
+/**
+ * Computes a hash of the structure of a graph which does not depend on node
+ * indices or native addresses: Two graphs built the same way (also in
+ * different runs of the compiler) get the same hash.
+ *
+ * The nodes are numbered in the order of a depth first search from the end
+ * node (visiting the block first, then the predecessors in order). The hash
+ * covers the entity of the graph (ld name, visibility, linkage and type) and
+ * for every node its opcode, mode, block, predecessors and the attributes
+ * relevant for code generation (constant values, referenced entities and
+ * types, Proj numbers, ...). Entities are identified by their ld name,
+ * selected entities also by their offset; types by their layout including
+ * the member offsets of compound types.
+ */
+public final class StructuralHash {
+
+	/** changes whenever the hashed data changes */
+	private static final int VERSION = 2;
+
+	private final MessageDigest digest;
+	private final byte[] scratch = new byte[8];
+
+	private StructuralHash() {
+		try {
+			digest = MessageDigest.getInstance("SHA-1");
+		} catch (NoSuchAlgorithmException e) {
+			throw new IllegalStateException("SHA-1 not available", e);
+		}
+	}
+
+	/**
+	 * computes the structural hash of a graph (a hex string)
+	 * @param graph          the graph
+	 * @param configuration  additional data influencing code generation (like
+	 *                       the backend options), may be null
+	 */
+	public static String compute(Graph graph, String configuration) {
+		StructuralHash hash = new StructuralHash();
+		hash.putInt(VERSION);
+		hash.putString(configuration);
+		hash.putEntity(binding_irgraph.get_irg_entity(graph.ptr));
+		hash.putGraph(graph.snapshot());
+		return hash.finish();
+	}
+
+	private void putGraph(GraphView view) {
+		int end = binding_irnode.get_irn_idx(binding_irgraph.get_irg_end(view.graph.ptr));
+
+		/* number nodes in depth first order */
+		int[] number = new int[view.size];
+		Arrays.fill(number, -1);
+		int[] order = new int[view.size];
+		int[] stack = new int[view.size];
+		int sp = 0;
+		int n = 0;
+		stack[sp++] = end;
+		while (sp > 0) {
+			int idx = stack[--sp];
+			if (!view.contains(idx) || number[idx] >= 0)
+				continue;
+			number[idx] = n;
+			order[n++] = idx;
+			/* push in reverse, so the block and the first predecessor come next */
+			for (int i = view.predStart[idx + 1] - 1; i >= view.predStart[idx]; --i) {
+				stack[sp++] = view.preds[i];
+				if (sp == stack.length)
+					stack = Arrays.copyOf(stack, stack.length * 2);
+			}
+			if (view.blocks[idx] >= 0) {
+				stack[sp++] = view.blocks[idx];
+				if (sp == stack.length)
+					stack = Arrays.copyOf(stack, stack.length * 2);
+			}
+		}
+
+		String[] modeNames = new String[view.getNModes()];
+		for (int m = 0; m < modeNames.length; ++m) {
+			modeNames[m] = view.getMode(m).getName();
+		}
+
+		putInt(n);
+		for (int i = 0; i < n; ++i) {
+			int idx = order[i];
+			putInt(view.opcodes[idx]);
+			putString(modeNames[view.modes[idx]]);
+			putInt(view.blocks[idx] >= 0 ? number[view.blocks[idx]] : -1);
+			putInt(view.getPredCount(idx));
+			for (int p = view.predStart[idx]; p < view.predStart[idx + 1]; ++p) {
+				putInt(number[view.preds[p]]);
+			}
+			if (view.hasLongValue[idx]) {
+				putLong(view.longValues[idx]);
+			} else {
+				putAttributes(view.getOpCode(idx), view.getPointer(idx));
+			}
+		}
+	}
+
+	private void putAttributes(ir_opcode opcode, Pointer node) {
+		if (opcode == null)
+			return;
+		switch (opcode) {
+		case iro_Const:
+			putTarval(binding_irnode.get_Const_tarval(node));
+			break;
+		case iro_SymConst: {
+			int kind = binding_irnode.get_SymConst_kind(node);
+			putInt(kind);
+			if (kind == symconst_kind.symconst_addr_ent.val || kind == symconst_kind.symconst_ofs_ent.val) {
+				putEntity(binding_irnode.get_SymConst_entity(node));
+			} else if (kind != symconst_kind.symconst_enum_const.val) {
+				putType(binding_irnode.get_SymConst_type(node));
+			}
+			break;
+		}
+		case iro_Sel: {
+			Pointer entity = binding_irnode.get_Sel_entity(node);
+			putEntity(entity);
+			putInt(binding_typerep.get_entity_offset(entity));
+			putInt(binding_typerep.get_entity_offset_bits_remainder(entity));
+			break;
+		}
+		case iro_Proj:
+			putLong(binding_irnode.get_Proj_proj(node).longValue());
+			break;
+		case iro_Load:
+			putMode(binding_irnode.get_Load_mode(node));
+			putInt(binding_irnode.get_Load_volatility(node));
+			putInt(binding_irnode.get_Load_align(node));
+			break;
+		case iro_Store:
+			putInt(binding_irnode.get_Store_volatility(node));
+			putInt(binding_irnode.get_Store_align(node));
+			break;
+		case iro_Div:
+			putMode(binding_irnode.get_Div_resmode(node));
+			putInt(binding_irnode.get_Div_no_remainder(node));
+			break;
+		case iro_Mod:
+			putMode(binding_irnode.get_Mod_resmode(node));
+			break;
+		case iro_DivMod:
+			putMode(binding_irnode.get_DivMod_resmode(node));
+			break;
+		case iro_Quot:
+			putMode(binding_irnode.get_Quot_resmode(node));
+			break;
+		case iro_Conv:
+			putInt(binding_irnode.get_Conv_strict(node));
+			break;
+		case iro_Cond:
+			putLong(binding_irnode.get_Cond_default_proj(node).longValue());
+			putInt(binding_irnode.get_Cond_jmp_pred(node));
+			break;
+		case iro_Confirm:
+			putInt(binding_irnode.get_Confirm_cmp(node));
+			break;
+		case iro_Call:
+			putType(binding_irnode.get_Call_type(node));
+			putInt(binding_irnode.get_Call_tail_call(node));
+			break;
+		case iro_Builtin:
+			putInt(binding_irnode.get_Builtin_kind(node));
+			putType(binding_irnode.get_Builtin_type(node));
+			break;
+		case iro_Alloc:
+			putInt(binding_irnode.get_Alloc_where(node));
+			putType(binding_irnode.get_Alloc_type(node));
+			break;
+		case iro_Free:
+			putInt(binding_irnode.get_Free_where(node));
+			putType(binding_irnode.get_Free_type(node));
+			break;
+		case iro_CopyB:
+			putType(binding_irnode.get_CopyB_type(node));
+			break;
+		case iro_ASM:
+			putString(binding_ident.get_id_str(binding_irnode.get_ASM_text(node)));
+			break;
+		default:
+			break;
+		}
+	}
+
+	private void putTarval(Pointer tv) {
+		Pointer mode = binding_tv.get_tarval_mode(tv);
+		putMode(mode);
+		int size = binding_irmode.get_mode_size_bytes(mode);
+		if (size <= 0) {
+			putInt(binding_tv.tarval_is_null(tv));
+			return;
+		}
+		for (int i = 0; i < size; ++i) {
+			digest.update(binding_tv.get_tarval_sub_bits(tv, i));
+		}
+	}
+
+	private void putMode(Pointer mode) {
+		putString(mode == null ? null : binding_irmode.get_mode_name(mode));
+	}
+
+	private void putEntity(Pointer entity) {
+		putString(binding_typerep.get_entity_ld_name(entity));
+		putInt(binding_typerep.get_entity_visibility(entity));
+		putInt(binding_typerep.get_entity_linkage(entity));
+		putType(binding_typerep.get_entity_type(entity));
+	}
+
+	/** hashes the layout of a type, method types with their parameters */
+	private void putType(Pointer type) {
+		if (type == null) {
+			putInt(-1);
+			return;
+		}
+		int opcode = binding_typerep.get_type_tpop_code(type);
+		putInt(opcode);
+		if (opcode == tp_opcode.tpo_method.val) {
+			int nParams = binding_typerep.get_method_n_params(type);
+			putInt(nParams);
+			for (int i = 0; i < nParams; ++i) {
+				putTypeLayout(binding_typerep.get_method_param_type(type, i));
+			}
+			int nRess = binding_typerep.get_method_n_ress(type);
+			putInt(nRess);
+			for (int i = 0; i < nRess; ++i) {
+				putTypeLayout(binding_typerep.get_method_res_type(type, i));
+			}
+			putInt(binding_typerep.get_method_variadicity(type));
+			putInt(binding_typerep.get_method_calling_convention(type));
+		} else {
+			putTypeLayout(type);
+		}
+	}
+
+	/**
+	 * hashes size and mode of a type, for compound types also the offsets
+	 * and layouts of the members, for arrays the element layout
+	 */
+	private void putTypeLayout(Pointer type) {
+		putInt(binding_typerep.get_type_tpop_code(type));
+		putInt(binding_typerep.get_type_size_bytes(type));
+		putMode(binding_typerep.get_type_mode(type));
+		if (binding_typerep.is_compound_type(type) != 0) {
+			int nMembers = binding_typerep.get_compound_n_members(type);
+			putInt(nMembers);
+			for (int i = 0; i < nMembers; ++i) {
+				Pointer member = binding_typerep.get_compound_member(type, i);
+				putInt(binding_typerep.get_entity_offset(member));
+				putInt(binding_typerep.get_entity_offset_bits_remainder(member));
+				putTypeLayout(binding_typerep.get_entity_type(member));
+			}
+		} else if (binding_typerep.is_Array_type(type) != 0) {
+			putTypeLayout(binding_typerep.get_array_element_type(type));
+		}
+	}
+
+	private void putInt(int value) {
+		scratch[0] = (byte) (value >>> 24);
+		scratch[1] = (byte) (value >>> 16);
+		scratch[2] = (byte) (value >>> 8);
+		scratch[3] = (byte) value;
+		digest.update(scratch, 0, 4);
+	}
+
+	private void putLong(long value) {
+		putInt((int) (value >>> 32));
+		putInt((int) value);
+	}
+
+	private void putString(String string) {
+		if (string == null) {
+			putInt(-1);
+			return;
+		}
+		try {
+			byte[] bytes = string.getBytes("UTF-8");
+			putInt(bytes.length);
+			digest.update(bytes);
+		} catch (UnsupportedEncodingException e) {
+			throw new IllegalStateException(e);
+		}
+	}
+
+	private String finish() {
+		byte[] bytes = digest.digest();
+		StringBuilder result = new StringBuilder(bytes.length * 2);
+		for (byte b : bytes) {
+			result.append(Character.forDigit((b >> 4) & 0xf, 16));
+			result.append(Character.forDigit(b & 0xf, 16));
+		}
+		return result.toString();
+	}
+}
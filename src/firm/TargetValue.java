@@ -1,8 +1,13 @@
 package firm;
 
+import java.util.HashMap;
+import java.util.LinkedHashMap;
+import java.util.Map;
+
 import com.sun.jna.NativeLong;
 import com.sun.jna.Pointer;
 
+import firm.bindings.EnumLookup;
 import firm.bindings.binding_tv;
 
 /**
@@ -12,6 +17,62 @@ import firm.bindings.binding_tv;
  */
 public class TargetValue extends JNAWrapper {
 	
+	/** interned values -128..127 per mode (key is the mode pointer) */
+	private static final Map<Pointer, TargetValue[]> smallValues = new HashMap<Pointer, TargetValue[]>();
+	private static final int SMALL_MIN = -128;
+	private static final int SMALL_MAX = 127;
+	
+	/** maximum number of other values kept by fromLong() */
+	private static final int MAX_CACHED = 4096;
+	
+	/** key of the cache for values outside of -128..127 */
+	private static final class Key {
+		final Pointer mode;
+		final long value;
+		
+		Key(Pointer mode, long value) {
+			this.mode = mode;
+			this.value = value;
+		}
+		
+		@Override
+		public boolean equals(Object obj) {
+			if (!(obj instanceof Key))
+				return false;
+			Key other = (Key) obj;
+			return value == other.value && mode.equals(other.mode);
+		}
+		
+		@Override
+		public int hashCode() {
+			return mode.hashCode() * 31 + (int) (value ^ (value >>> 32));
+		}
+	}
+	
+	/**
+	 * recently used values outside of -128..127, least recently used ones are
+	 * dropped first (tarvals live until ir_finish, so this is only a cache)
+	 */
+	private static final Map<Key, TargetValue> cachedValues = new LinkedHashMap<Key, TargetValue>(256, 0.75f, true) {
+		private static final long serialVersionUID = 1L;
+		
+		@Override
+		protected boolean removeEldestEntry(Map.Entry<Key, TargetValue> eldest) {
+			return size() > MAX_CACHED;
+		}
+	};
+	
+	/** cached mode, null if not known yet */
+	private Mode mode;
+	
+	/**
+	 * state of the java-side copy of the value: 0 not computed yet,
+	 * 1 longValue is valid and the value can be folded in java,
+	 * 2 the value has to be handled by the tarval module
+	 */
+	private byte longState;
+	private long longValue;
+	
 	public TargetValue(Pointer ptr) {
 		super(ptr);
 	}
@@ -23,20 +84,130 @@ public class TargetValue extends JNAWrapper {
 	
 	public TargetValue(long l, Mode mode) {
 		this(binding_tv.new_tarval_from_long(new NativeLong(l), mode.ptr));
+		setValue(l, mode);
 	}
 	
 	public TargetValue(int i, Mode mode) {
 		this((long) i, mode);
 	}
 	
+	/** remembers value as java-side copy if it is representable in mode */
+	private void setValue(long value, Mode mode) {
+		this.mode = mode;
+		int bits = mode.getFoldBits();
+		if (bits != 0 && wrap(value, bits, mode.isFoldSigned()) == value) {
+			longValue = value;
+			longState = 1;
+		}
+	}
+	
+	/** returns true if fromLong() interns the value (for representable values) */
+	static boolean isSmall(long value) {
+		return value >= SMALL_MIN && value <= SMALL_MAX;
+	}
+	
+	/**
+	 * returns a TargetValue for an integer. Values between -128 and 127 are
+	 * interned per mode, so creating them again (for example for Const
+	 * nodes) needs no call into the tarval module. Other values are kept in
+	 * a bounded cache of recently used values; a value not found there still
+	 * needs a tarval from the tarval module, because every TargetValue
+	 * carries its native tarval.
+	 */
+	public static TargetValue fromLong(long value, Mode mode) {
+		int bits = mode.getFoldBits();
+		if (bits == 0 || wrap(value, bits, mode.isFoldSigned()) != value)
+			return new TargetValue(value, mode);
+		if (!isSmall(value)) {
+			Key key = new Key(mode.ptr, value);
+			TargetValue result = cachedValues.get(key);
+			if (result == null) {
+				result = new TargetValue(value, mode);
+				cachedValues.put(key, result);
+			}
+			return result;
+		}
+		
+		TargetValue[] values = smallValues.get(mode.ptr);
+		if (values == null) {
+			values = new TargetValue[SMALL_MAX - SMALL_MIN + 1];
+			smallValues.put(mode.ptr, values);
+		}
+		int i = (int) value - SMALL_MIN;
+		TargetValue result = values[i];
+		if (result == null) {
+			result = new TargetValue(value, mode);
+			values[i] = result;
+		}
+		return result;
+	}
+	
+	/** forget interned values, tarvals are invalid after Firm.finish() */
+	static void clearCache() {
+		smallValues.clear();
+		cachedValues.clear();
+	}
+	
+	/** wraps value around to an integer mode with the given bit size */
+	static long wrap(long value, int bits, boolean signed) {
+		if (bits >= 64)
+			return value;
+		long mask = (1L << bits) - 1;
+		value &= mask;
+		if (signed && (value & (1L << (bits - 1))) != 0)
+			value |= ~mask;
+		return value;
+	}
+	
+	/** returns true if the value can be folded on the java side */
+	private boolean hasFoldableValue() {
+		if (longState == 0) {
+			longState = 2;
+			Mode mode = getMode();
+			if (mode.getFoldBits() != 0 && isLong()) {
+				longValue = binding_tv.get_tarval_long(ptr).longValue();
+				longState = 1;
+			}
+		}
+		return longState == 1;
+	}
+	
+	private boolean canFold(TargetValue other) {
+		return hasFoldableValue() && other.hasFoldableValue()
+			&& getMode() == other.getMode();
+	}
+	
+	/**
+	 * creates the result of a java-side arithmetic operation, returns null
+	 * if the result may have overflowed and the overflow mode is not
+	 * wrap-around (then the tarval module has to decide what to do)
+	 */
+	private static TargetValue folded(long result, Mode mode) {
+		int bits = mode.getFoldBits();
+		long wrapped = wrap(result, bits, mode.isFoldSigned());
+		/* operations on more than 32 bits might have overflowed the long */
+		boolean mayOverflow = wrapped != result || bits > 32;
+		if (mayOverflow && getIntegerOverflowMode() != int_overflow_mode.TV_OVERFLOW_WRAP)
+			return null;
+		return fromLong(wrapped, mode);
+	}
+	
+	/** creates the result of a java-side bit operation (always wraps around) */
+	private static TargetValue foldedBits(long result, Mode mode) {
+		return fromLong(wrap(result, mode.getFoldBits(), mode.isFoldSigned()), mode);
+	}
 	
 	/** return true if the value can be represented in a C long type */
 	public final boolean isLong() {
+		if (longState == 1)
+			return true;
 		return 0 != binding_tv.tarval_is_long(ptr);
 	}
 	
 	/** return value as long */
 	public final long asLong() {
+		if (longState == 1)
+			return longValue;
 		NativeLong l = binding_tv.get_tarval_long(ptr);
 		return l.longValue();
 	}
@@ -63,8 +234,11 @@ public class TargetValue extends JNAWrapper {
 	}
 	
 	public final Mode getMode() {
-		Pointer pmode = binding_tv.get_tarval_mode(ptr);
-		return new Mode(pmode);
+		if (mode == null) {
+			Pointer pmode = binding_tv.get_tarval_mode(ptr);
+			mode = Mode.createWrapper(pmode);
+		}
+		return mode;
 	}
 	
 	public final boolean isNegative() {
@@ -181,12 +355,10 @@ public class TargetValue extends JNAWrapper {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<int_overflow_mode> lookup = new EnumLookup<int_overflow_mode>(values());
+
 		public static int_overflow_mode getEnum(int val) {
-			for(int_overflow_mode entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 
@@ -194,9 +366,13 @@ public class TargetValue extends JNAWrapper {
 		binding_tv.tarval_set_integer_overflow_mode(ovMode.val);
 	}
 
+	/**
+	 * returns the current overflow mode. This is read from libfirm each
+	 * time (the mode may also be set through the bindings), the java-side
+	 * folding only asks for it when a result may have overflowed.
+	 */
 	public static final int_overflow_mode getIntegerOverflowMode() {
-		int val = binding_tv.tarval_get_integer_overflow_mode();
-		return int_overflow_mode.getEnum(val);
+		return int_overflow_mode.getEnum(binding_tv.tarval_get_integer_overflow_mode());
 	}
 	
 	public final CompareResult compare(TargetValue other) {
@@ -209,26 +385,49 @@ public class TargetValue extends JNAWrapper {
 	}
 	
 	public final TargetValue not() {
+		if (hasFoldableValue()) {
+			return foldedBits(~longValue, mode);
+		}
 		Pointer ptarval = binding_tv.tarval_not(ptr);
 		return new TargetValue(ptarval);
 	}
 
 	public final TargetValue neg() {
+		if (hasFoldableValue() && mode.isFoldSigned()) {
+			TargetValue result = folded(-longValue, mode);
+			if (result != null)
+				return result;
+		}
 		Pointer ptarval = binding_tv.tarval_neg(ptr);
 		return new TargetValue(ptarval);
 	}
 
 	public final TargetValue add(TargetValue other) {
+		if (canFold(other)) {
+			TargetValue result = folded(longValue + other.longValue, mode);
+			if (result != null)
+				return result;
+		}
 		Pointer ptarval = binding_tv.tarval_add(ptr, other.ptr);
 		return new TargetValue(ptarval);
 	}
 
 	public final TargetValue sub(TargetValue other, Mode dstMode) {
+		if (canFold(other) && dstMode == mode) {
+			TargetValue result = folded(longValue - other.longValue, mode);
+			if (result != null)
+				return result;
+		}
 		Pointer ptarval = binding_tv.tarval_sub(ptr, other.ptr, dstMode.ptr);
 		return new TargetValue(ptarval);
 	}
 
 	public final TargetValue mul(TargetValue other) {
+		if (canFold(other)) {
+			TargetValue result = folded(longValue * other.longValue, mode);
+			if (result != null)
+				return result;
+		}
 		Pointer ptarval = binding_tv.tarval_mul(ptr, other.ptr);
 		return new TargetValue(ptarval);
 	}
@@ -254,35 +453,74 @@ public class TargetValue extends JNAWrapper {
 	}
 
 	public final TargetValue and(TargetValue other) {
+		if (canFold(other)) {
+			return foldedBits(longValue & other.longValue, mode);
+		}
 		Pointer ptarval = binding_tv.tarval_and(ptr, other.ptr);
 		return new TargetValue(ptarval);
 	}
 
 	public final TargetValue or(TargetValue other) {
+		if (canFold(other)) {
+			return foldedBits(longValue | other.longValue, mode);
+		}
 		Pointer ptarval = binding_tv.tarval_or(ptr, other.ptr);
 		return new TargetValue(ptarval);
 	}
 
 	public final TargetValue eor(TargetValue other) {
+		if (canFold(other)) {
+			return foldedBits(longValue ^ other.longValue, mode);
+		}
 		Pointer ptarval = binding_tv.tarval_eor(ptr, other.ptr);
 		return new TargetValue(ptarval);
 	}
 
 	public final TargetValue shl(TargetValue other) {
+		int count = getShiftCount(other);
+		if (count >= 0) {
+			return foldedBits(count < 64 ? longValue << count : 0, mode);
+		}
 		Pointer ptarval = binding_tv.tarval_shl(ptr, other.ptr);
 		return new TargetValue(ptarval);
 	}
 
 	public final TargetValue shr(TargetValue other) {
+		int count = getShiftCount(other);
+		if (count >= 0) {
+			long bits = wrap(longValue, mode.getFoldBits(), false);
+			return foldedBits(count < 64 ? bits >>> count : 0, mode);
+		}
 		Pointer ptarval = binding_tv.tarval_shr(ptr, other.ptr);
 		return new TargetValue(ptarval);
 	}
 
 	public final TargetValue shrs(TargetValue other) {
+		int count = getShiftCount(other);
+		if (count >= 0) {
+			long bits = wrap(longValue, mode.getFoldBits(), true);
+			return foldedBits(bits >> Math.min(count, 63), mode);
+		}
 		Pointer ptarval = binding_tv.tarval_shrs(ptr, other.ptr);
 		return new TargetValue(ptarval);
 	}
 
+	/**
+	 * returns the (modulo reduced) shift count for a java-side shift of this
+	 * value by other, or -1 if the shift must be done by the tarval module
+	 */
+	private int getShiftCount(TargetValue other) {
+		if (!hasFoldableValue() || !other.hasFoldableValue())
+			return -1;
+		long count = other.longValue;
+		if (count < 0)
+			return -1;
+		int moduloShift = mode.getFoldModuloShift();
+		if (moduloShift != 0)
+			count %= moduloShift;
+		return (int) Math.min(count, 64);
+	}
+
 	public final TargetValue rotl(TargetValue other) {
 		Pointer ptarval = binding_tv.tarval_rotl(ptr, other.ptr);
 		return new TargetValue(ptarval);
@@ -311,12 +549,10 @@ public class TargetValue extends JNAWrapper {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<tv_output_mode> lookup = new EnumLookup<tv_output_mode>(values());
+
 		public static tv_output_mode getEnum(int val) {
-			for(tv_output_mode entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	
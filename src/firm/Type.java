@@ -1,36 +1,79 @@
 package firm;
 
+import java.util.HashMap;
+import java.util.Map;
+
 import com.sun.jna.Pointer;
 
 import firm.bindings.binding_tv;
 import firm.bindings.binding_typerep;
 import firm.bindings.binding_typerep.ir_type_state;
+import firm.bindings.binding_typerep.tp_opcode;
 
 public class Type extends JNAWrapper {
 	
+	/** wrapper objects of all types seen so far (key is the type pointer) */
+	private static final Map<Pointer, Type> types = new HashMap<Pointer, Type>();
+	
 	protected Type(Pointer ptr) {
 		super(ptr);
+		types.put(ptr, this);
 	}
 	
+	/**
+	 * returns the wrapper object for a type. The wrapper class is determined
+	 * with a single get_type_tpop_code call, wrappers are cached per type so
+	 * later calls need no native call at all.
+	 */
 	public static Type createWrapper(Pointer ptr) {
-		if (binding_tv.is_Primitive_type(ptr) != 0) {
+		Type type = types.get(ptr);
+		if (type != null)
+			return type;
+		
+		tp_opcode opcode = tp_opcode.getEnum(binding_typerep.get_type_tpop_code(ptr));
+		if (opcode == null)
+			opcode = tp_opcode.tpo_unknown;
+		switch (opcode) {
+		case tpo_primitive:
 			return new PrimitiveType(ptr);
-		} else if (binding_tv.is_Method_type(ptr) != 0) {
+		case tpo_method:
 			return new MethodType(ptr);
-		} else if (binding_tv.is_Array_type(ptr) != 0) {
+		case tpo_array:
 			return new ArrayType(ptr);
-		} else if (binding_tv.is_Class_type(ptr) != 0) {
+		case tpo_class:
 			return new ClassType(ptr);
-		} else if (binding_tv.is_Pointer_type(ptr) != 0) {
+		case tpo_pointer:
 			return new PointerType(ptr);
-		} else {
-			Type type = new Type(ptr);
-			if (binding_tv.is_Struct_type(ptr) == 0)
-				System.err.println("Unknown Type kind found");
-			return type;
+		case tpo_struct:
+			return new Type(ptr);
+		default:
+			System.err.println("Unknown Type kind found");
+			return new Type(ptr);
 		}
 	}
 	
+	/** forget all wrappers, types are invalid after Firm.finish() */
+	static void clearCache() {
+		types.clear();
+	}
+	
+	/**
+	 * forget the wrapper of a type which is freed natively, its address
+	 * may be reused for a type of another kind
+	 */
+	static void forget(Pointer ptr) {
+		types.remove(ptr);
+	}
+	
+	/**
+	 * frees the type (free_type). You are not allowed to use the type
+	 * anymore after calling this.
+	 */
+	public void free() {
+		forget(ptr);
+		binding_typerep.free_type(ptr);
+	}
+	
 	public void setSizeBytes(int size) {
 		binding_tv.set_type_size_bytes(ptr, size);
 	}
@@ -60,7 +103,7 @@ public class Type extends JNAWrapper {
 		Pointer mode_ptr = binding_tv.get_type_mode(ptr);
 		if (mode_ptr == null)
 			return null;
-		return new Mode(mode_ptr);
+		return Mode.createWrapper(mode_ptr);
 	}
 
 	/** you must call this function when you are finished constructing a type */
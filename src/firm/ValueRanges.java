@@ -0,0 +1,162 @@
+package firm;
+
+import com.sun.jna.Pointer;
+
+import firm.bindings.binding_tv;
+import firm.bindings.binding_vrp;
+import firm.bindings.binding_vrp.range_types;
+import firm.bindings.binding_vrp.vrp_attr;
+import firm.nodes.Node;
+
+/**
+ * Value ranges and known bits of the nodes of a graph, computed by the
+ * native value range propagation (set_vrp_data) and exported into arrays
+ * indexed by node idx (see Node.getIdx()).
+ *
+ * For integer values that fit into a long the range borders and bit masks
+ * are available directly in the long arrays (check hasLongValues), the
+ * TargetValues are available through getRangeBottom() and friends.
+ * The arrays are a snapshot like GraphView.
+ */
+public final class ValueRanges {
+
+	/** the graph */
+	public final Graph graph;
+
+	/** number of node indices (see GraphView.size) */
+	public final int size;
+
+	/** true for nodes with valid vrp information */
+	public final boolean[] valid;
+
+	/** the range_types value of the nodes (VRP_UNDEFINED if not valid) */
+	public final byte[] rangeTypes;
+
+	/** true if the range borders and bit masks are stored in the long arrays */
+	public final boolean[] hasLongValues;
+
+	/** lower border of the range (included) */
+	public final long[] rangeBottom;
+
+	/** upper border of the range (included) */
+	public final long[] rangeTop;
+
+	/** bits which are definitely set */
+	public final long[] bitsSet;
+
+	/** bits which may be set (0 bits are definitely not set) */
+	public final long[] bitsNotSet;
+
+	private final NodeIndex nodes;
+	private final Pointer[] tarvals;
+
+	private static final int RANGE_BOTTOM = 0;
+	private static final int RANGE_TOP = 1;
+	private static final int BITS_SET = 2;
+	private static final int BITS_NOT_SET = 3;
+
+	ValueRanges(Graph graph) {
+		this.graph = graph;
+		binding_vrp.set_vrp_data(graph.ptr);
+
+		nodes = NodeIndex.collectNodes(graph);
+		size = nodes.size;
+		valid = new boolean[size];
+		rangeTypes = new byte[size];
+		hasLongValues = new boolean[size];
+		rangeBottom = new long[size];
+		rangeTop = new long[size];
+		bitsSet = new long[size];
+		bitsNotSet = new long[size];
+		tarvals = new Pointer[4 * size];
+
+		for (int idx = 0; idx < size; ++idx) {
+			Pointer node = nodes.get(idx);
+			if (node != null)
+				collect(idx, node);
+		}
+	}
+
+	/** exports the vrp information of a node */
+	private void collect(int idx, Pointer node) {
+		Pointer info = binding_vrp.vrp_get_info(node);
+		if (info == null)
+			return;
+		vrp_attr attr = new vrp_attr(info);
+		if (attr.valid == 0)
+			return;
+
+		valid[idx] = true;
+		rangeTypes[idx] = (byte) attr.range_type;
+		tarvals[4 * idx + RANGE_BOTTOM] = attr.range_bottom;
+		tarvals[4 * idx + RANGE_TOP] = attr.range_top;
+		tarvals[4 * idx + BITS_SET] = attr.bits_set;
+		tarvals[4 * idx + BITS_NOT_SET] = attr.bits_not_set;
+
+		if (isLong(attr.range_bottom) && isLong(attr.range_top)
+				&& isLong(attr.bits_set) && isLong(attr.bits_not_set)) {
+			hasLongValues[idx] = true;
+			rangeBottom[idx] = binding_tv.get_tarval_long(attr.range_bottom).longValue();
+			rangeTop[idx] = binding_tv.get_tarval_long(attr.range_top).longValue();
+			bitsSet[idx] = binding_tv.get_tarval_long(attr.bits_set).longValue();
+			bitsNotSet[idx] = binding_tv.get_tarval_long(attr.bits_not_set).longValue();
+		}
+	}
+
+	private static boolean isLong(Pointer tarval) {
+		return tarval != null && binding_tv.tarval_is_long(tarval) != 0;
+	}
+
+	/** returns the range type of a node */
+	public range_types getRangeType(int idx) {
+		return range_types.getEnum(rangeTypes[idx]);
+	}
+
+	/**
+	 * returns true if the value of a node is known to be in the range
+	 * [min, max] (both included)
+	 */
+	public boolean isInRange(int idx, long min, long max) {
+		return valid[idx] && hasLongValues[idx]
+			&& rangeTypes[idx] == range_types.VRP_RANGE.val
+			&& rangeBottom[idx] >= min && rangeTop[idx] <= max;
+	}
+
+	private TargetValue getTarval(int idx, int which) {
+		Pointer tarval = valid[idx] ? tarvals[4 * idx + which] : null;
+		return tarval == null ? null : new TargetValue(tarval);
+	}
+
+	/** returns the lower border of the range of a node or null */
+	public TargetValue getRangeBottom(int idx) {
+		return getTarval(idx, RANGE_BOTTOM);
+	}
+
+	/** returns the upper border of the range of a node or null */
+	public TargetValue getRangeTop(int idx) {
+		return getTarval(idx, RANGE_TOP);
+	}
+
+	/** returns the bits which are definitely set in a node or null */
+	public TargetValue getBitsSet(int idx) {
+		return getTarval(idx, BITS_SET);
+	}
+
+	/** returns the bits which may be set in a node or null */
+	public TargetValue getBitsNotSet(int idx) {
+		return getTarval(idx, BITS_NOT_SET);
+	}
+
+	/**
+	 * compares two nodes using their value ranges, returns the relation
+	 * which is known to hold (CompareResult.False if nothing is known)
+	 */
+	public static CompareResult compare(Node left, Node right) {
+		return CompareResult.fromProjNum(binding_vrp.vrp_cmp(left.ptr, right.ptr));
+	}
+
+	/** returns the wrapper object for the node with the given idx or null */
+	public Node getNode(int idx) {
+		return nodes.getNode(idx);
+	}
+}
@@ -0,0 +1,83 @@
+package firm;
+
+import com.sun.jna.Pointer;
+
+import firm.bindings.binding_irextbb;
+import firm.bindings.binding_irgwalk;
+import firm.nodes.Block;
+import firm.nodes.Node;
+import firm.nodes.NodeVisitor;
+
+/**
+ * Adapts NodeVisitors/BlockWalkers/ExtendedBlockWalkers to the native
+ * walker callbacks (the node and extended block walker callbacks have the
+ * same signature). Exceptions can't be thrown through the native walker,
+ * so the first one is recorded (further nodes are skipped) and rethrown
+ * after the walk.
+ */
+final class WalkCallback implements binding_irgwalk.irg_walk_func, binding_irextbb.extbb_walk_func {
+	private final NodeVisitor visitor;
+	private final BlockWalker blockWalker;
+	private final ExtendedBlockWalker extendedBlockWalker;
+	private Throwable failure;
+	
+	public WalkCallback(NodeVisitor visitor) {
+		this.visitor = visitor;
+		this.blockWalker = null;
+		this.extendedBlockWalker = null;
+	}
+	
+	public WalkCallback(BlockWalker blockWalker) {
+		this.visitor = null;
+		this.blockWalker = blockWalker;
+		this.extendedBlockWalker = null;
+	}
+	
+	public WalkCallback(ExtendedBlockWalker extendedBlockWalker) {
+		this.visitor = null;
+		this.blockWalker = null;
+		this.extendedBlockWalker = extendedBlockWalker;
+	}
+	
+	@Override
+	public void callback(Pointer node, Pointer env) {
+		if (failure != null)
+			return;
+		try {
+			if (blockWalker != null) {
+				blockWalker.visitBlock((Block) Node.createWrapper(node));
+			} else if (extendedBlockWalker != null) {
+				extendedBlockWalker.visitExtendedBlock(new ExtendedBlock(node));
+			} else {
+				Node.createWrapper(node).accept(visitor);
+			}
+		} catch (RuntimeException e) {
+			failure = e;
+		} catch (Error e) {
+			failure = e;
+		}
+	}
+	
+	public static WalkCallback create(NodeVisitor visitor) {
+		return visitor == null ? null : new WalkCallback(visitor);
+	}
+	
+	public static WalkCallback create(BlockWalker walker) {
+		return walker == null ? null : new WalkCallback(walker);
+	}
+	
+	public static WalkCallback create(ExtendedBlockWalker walker) {
+		return walker == null ? null : new WalkCallback(walker);
+	}
+	
+	public static void rethrow(WalkCallback pre, WalkCallback post) {
+		for (WalkCallback callback : new WalkCallback[] { pre, post }) {
+			if (callback == null || callback.failure == null)
+				continue;
+			if (callback.failure instanceof Error)
+				throw (Error) callback.failure;
+			throw (RuntimeException) callback.failure;
+		}
+	}
+}
+
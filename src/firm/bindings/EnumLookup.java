@@ -0,0 +1,91 @@
+package firm.bindings;
+
+import java.lang.reflect.Field;
+import java.util.Arrays;
+
+/**
+ * Maps the integer values of the generated binding enums back to their
+ * enum constants. The table is built once per enum, so getEnum() is an
+ * array load for the usual dense enums (like ir_opcode) and a binary search
+ * for sparse ones (like bitflag enums).
+ * If several constants share a value the first declared one wins, just like
+ * the linear search the generated code used before.
+ */
+public final class EnumLookup<E extends Enum<E>> {
+
+	/** enums with bigger values than this are not stored in a dense array */
+	private static final int MAX_DENSE_SIZE = 1024;
+
+	private final E[] dense;
+	private final int[] sortedVals;
+	private final E[] sortedEntries;
+
+	public EnumLookup(E[] entries) {
+		int[] vals = new int[entries.length];
+		int min = 0;
+		int max = -1;
+		for (int i = 0; i < entries.length; ++i) {
+			vals[i] = getVal(entries[i]);
+			if (i == 0 || vals[i] < min)
+				min = vals[i];
+			if (i == 0 || vals[i] > max)
+				max = vals[i];
+		}
+
+		if (min >= 0 && max < MAX_DENSE_SIZE) {
+			dense = Arrays.copyOf(entries, max + 1);
+			Arrays.fill(dense, null);
+			for (int i = 0; i < entries.length; ++i) {
+				if (dense[vals[i]] == null)
+					dense[vals[i]] = entries[i];
+			}
+			sortedVals = null;
+			sortedEntries = null;
+		} else {
+			dense = null;
+			/* sort by value, keeping the first declared entry for duplicates */
+			int[] sorted = vals.clone();
+			Arrays.sort(sorted);
+			int n = 0;
+			for (int i = 0; i < sorted.length; ++i) {
+				if (n == 0 || sorted[n - 1] != sorted[i])
+					sorted[n++] = sorted[i];
+			}
+			sortedVals = Arrays.copyOf(sorted, n);
+			sortedEntries = Arrays.copyOf(entries, n);
+			Arrays.fill(sortedEntries, null);
+			for (int i = 0; i < entries.length; ++i) {
+				int idx = Arrays.binarySearch(sortedVals, vals[i]);
+				if (sortedEntries[idx] == null)
+					sortedEntries[idx] = entries[i];
+			}
+		}
+	}
+
+	private static int getVal(Enum<?> entry) {
+		try {
+			Field field = entry.getDeclaringClass().getField("val");
+			return field.getInt(entry);
+		} catch (NoSuchFieldException e) {
+			throw new IllegalArgumentException("enum " + entry.getDeclaringClass() + " has no val field", e);
+		} catch (IllegalAccessException e) {
+			throw new IllegalArgumentException("enum " + entry.getDeclaringClass() + " has no public val field", e);
+		}
+	}
+
+	/**
+	 * returns the enum constant with the given value or null if there is none
+	 */
+	public E get(int val) {
+		if (dense != null) {
+			if (val < 0 || val >= dense.length)
+				return null;
+			return dense[val];
+		}
+
+		int idx = Arrays.binarySearch(sortedVals, val);
+		if (idx < 0)
+			return null;
+		return sortedEntries[idx];
+	}
+}
@@ -23,12 +23,10 @@ public class binding_be {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<__codecvt_result> lookup = new EnumLookup<__codecvt_result>(values());
+
 		public static __codecvt_result getEnum(int val) {
-			for(__codecvt_result entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum op_pin_state {
@@ -47,12 +45,10 @@ public class binding_be {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<op_pin_state> lookup = new EnumLookup<op_pin_state>(values());
+
 		public static op_pin_state getEnum(int val) {
-			for(op_pin_state entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum cond_jmp_predicate {
@@ -70,12 +66,10 @@ public class binding_be {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<cond_jmp_predicate> lookup = new EnumLookup<cond_jmp_predicate>(values());
+
 		public static cond_jmp_predicate getEnum(int val) {
-			for(cond_jmp_predicate entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum mtp_additional_property {
@@ -103,12 +97,10 @@ public class binding_be {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<mtp_additional_property> lookup = new EnumLookup<mtp_additional_property>(values());
+
 		public static mtp_additional_property getEnum(int val) {
-			for(mtp_additional_property entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum symconst_kind {
@@ -129,12 +121,10 @@ public class binding_be {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<symconst_kind> lookup = new EnumLookup<symconst_kind>(values());
+
 		public static symconst_kind getEnum(int val) {
-			for(symconst_kind entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_where_alloc {
@@ -151,12 +141,10 @@ public class binding_be {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_where_alloc> lookup = new EnumLookup<ir_where_alloc>(values());
+
 		public static ir_where_alloc getEnum(int val) {
-			for(ir_where_alloc entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_builtin_kind {
@@ -185,12 +173,10 @@ public class binding_be {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_builtin_kind> lookup = new EnumLookup<ir_builtin_kind>(values());
+
 		public static ir_builtin_kind getEnum(int val) {
-			for(ir_builtin_kind entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_generic {
@@ -209,12 +195,10 @@ public class binding_be {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_generic> lookup = new EnumLookup<pn_generic>(values());
+
 		public static pn_generic getEnum(int val) {
-			for(pn_generic entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_value_classify_sign {
@@ -232,12 +216,10 @@ public class binding_be {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_value_classify_sign> lookup = new EnumLookup<ir_value_classify_sign>(values());
+
 		public static ir_value_classify_sign getEnum(int val) {
-			for(ir_value_classify_sign entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum insn_kind {
@@ -259,12 +241,10 @@ public class binding_be {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<insn_kind> lookup = new EnumLookup<insn_kind>(values());
+
 		public static insn_kind getEnum(int val) {
-			for(insn_kind entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum arch_dep_opts_t {
@@ -283,12 +263,10 @@ public class binding_be {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<arch_dep_opts_t> lookup = new EnumLookup<arch_dep_opts_t>(values());
+
 		public static arch_dep_opts_t getEnum(int val) {
-			for(arch_dep_opts_t entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum add_hidden {
@@ -306,12 +284,10 @@ public class binding_be {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<add_hidden> lookup = new EnumLookup<add_hidden>(values());
+
 		public static add_hidden getEnum(int val) {
-			for(add_hidden entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum lowering_flags {
@@ -331,12 +307,10 @@ public class binding_be {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<lowering_flags> lookup = new EnumLookup<lowering_flags>(values());
+
 		public static lowering_flags getEnum(int val) {
-			for(lowering_flags entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ikind {
@@ -353,12 +327,10 @@ public class binding_be {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ikind> lookup = new EnumLookup<ikind>(values());
+
 		public static ikind getEnum(int val) {
-			for(ikind entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_Alloc {
@@ -378,12 +350,10 @@ public class binding_be {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_Alloc> lookup = new EnumLookup<pn_Alloc>(values());
+
 		public static pn_Alloc getEnum(int val) {
-			for(pn_Alloc entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_Bound {
@@ -403,12 +373,10 @@ public class binding_be {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_Bound> lookup = new EnumLookup<pn_Bound>(values());
+
 		public static pn_Bound getEnum(int val) {
-			for(pn_Bound entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_Builtin {
@@ -426,12 +394,10 @@ public class binding_be {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_Builtin> lookup = new EnumLookup<pn_Builtin>(values());
+
 		public static pn_Builtin getEnum(int val) {
-			for(pn_Builtin entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_Call {
@@ -452,12 +418,10 @@ public class binding_be {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_Call> lookup = new EnumLookup<pn_Call>(values());
+
 		public static pn_Call getEnum(int val) {
-			for(pn_Call entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_Cmp {
@@ -489,12 +453,10 @@ public class binding_be {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_Cmp> lookup = new EnumLookup<pn_Cmp>(values());
+
 		public static pn_Cmp getEnum(int val) {
-			for(pn_Cmp entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_Cond {
@@ -512,12 +474,10 @@ public class binding_be {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_Cond> lookup = new EnumLookup<pn_Cond>(values());
+
 		public static pn_Cond getEnum(int val) {
-			for(pn_Cond entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_CopyB {
@@ -536,12 +496,10 @@ public class binding_be {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_CopyB> lookup = new EnumLookup<pn_CopyB>(values());
+
 		public static pn_CopyB getEnum(int val) {
-			for(pn_CopyB entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_Div {
@@ -561,12 +519,10 @@ public class binding_be {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_Div> lookup = new EnumLookup<pn_Div>(values());
+
 		public static pn_Div getEnum(int val) {
-			for(pn_Div entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_DivMod {
@@ -587,12 +543,10 @@ public class binding_be {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_DivMod> lookup = new EnumLookup<pn_DivMod>(values());
+
 		public static pn_DivMod getEnum(int val) {
-			for(pn_DivMod entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_InstOf {
@@ -612,12 +566,10 @@ public class binding_be {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_InstOf> lookup = new EnumLookup<pn_InstOf>(values());
+
 		public static pn_InstOf getEnum(int val) {
-			for(pn_InstOf entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_Load {
@@ -637,12 +589,10 @@ public class binding_be {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_Load> lookup = new EnumLookup<pn_Load>(values());
+
 		public static pn_Load getEnum(int val) {
-			for(pn_Load entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_Mod {
@@ -662,12 +612,10 @@ public class binding_be {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_Mod> lookup = new EnumLookup<pn_Mod>(values());
+
 		public static pn_Mod getEnum(int val) {
-			for(pn_Mod entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_Quot {
@@ -687,12 +635,10 @@ public class binding_be {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_Quot> lookup = new EnumLookup<pn_Quot>(values());
+
 		public static pn_Quot getEnum(int val) {
-			for(pn_Quot entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_Raise {
@@ -710,12 +656,10 @@ public class binding_be {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_Raise> lookup = new EnumLookup<pn_Raise>(values());
+
 		public static pn_Raise getEnum(int val) {
-			for(pn_Raise entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_Start {
@@ -736,12 +680,10 @@ public class binding_be {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_Start> lookup = new EnumLookup<pn_Start>(values());
+
 		public static pn_Start getEnum(int val) {
-			for(pn_Start entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_Store {
@@ -760,12 +702,10 @@ public class binding_be {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_Store> lookup = new EnumLookup<pn_Store>(values());
+
 		public static pn_Store getEnum(int val) {
-			for(pn_Store entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum osr_flags {
@@ -784,12 +724,10 @@ public class binding_be {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<osr_flags> lookup = new EnumLookup<osr_flags>(values());
+
 		public static osr_flags getEnum(int val) {
-			for(osr_flags entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum asm_constraint_flags_t {
@@ -815,12 +753,10 @@ public class binding_be {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<asm_constraint_flags_t> lookup = new EnumLookup<asm_constraint_flags_t>(values());
+
 		public static asm_constraint_flags_t getEnum(int val) {
-			for(asm_constraint_flags_t entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static native void arch_dep_set_opts(/* arch_dep_opts_t */int opts);
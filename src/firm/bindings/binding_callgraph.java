@@ -0,0 +1,62 @@
+package firm.bindings;
+
+import com.sun.jna.Callback;
+import com.sun.jna.Native;
+import com.sun.jna.Pointer;
+
+/**
+ * Callgraph from callgraph.h, hand-written (see binding_irgwalk).
+ * get_irg_caller is not exported (no FIRM_API) in this libfirm version,
+ * callers have to be derived from the callees.
+ */
+public class binding_callgraph {
+	static { Native.register("firm"); }
+	
+	public static enum irp_callgraph_state {
+		irp_callgraph_none(),
+		irp_callgraph_consistent(),
+		irp_callgraph_inconsistent(),
+		irp_callgraph_and_calltree_consistent();
+		public final int val;
+		private static class C { static int next_val; }
+
+		irp_callgraph_state(int val) {
+			this.val = val;
+			C.next_val = val + 1;
+		}
+		irp_callgraph_state() {
+			this.val = C.next_val++;
+		}
+		
+		private static final EnumLookup<irp_callgraph_state> lookup = new EnumLookup<irp_callgraph_state>(values());
+
+		public static irp_callgraph_state getEnum(int val) {
+			return lookup.get(val);
+		}
+	}
+	
+	public interface callgraph_walk_func extends Callback {
+		void callback(Pointer g, Pointer env);
+	}
+	
+	public static native /* irp_callgraph_state */int get_irp_callgraph_state();
+	public static native void set_irp_callgraph_state(/* irp_callgraph_state */int s);
+	public static native int get_irg_n_callers(Pointer irg);
+	public static native int is_irg_caller_backedge(Pointer irg, int pos);
+	public static native int has_irg_caller_backedge(Pointer irg);
+	public static native int get_irg_caller_loop_depth(Pointer irg, int pos);
+	public static native int get_irg_n_callees(Pointer irg);
+	public static native Pointer get_irg_callee(Pointer irg, int pos);
+	public static native int is_irg_callee_backedge(Pointer irg, int pos);
+	public static native int has_irg_callee_backedge(Pointer irg);
+	public static native int get_irg_callee_loop_depth(Pointer irg, int pos);
+	public static native int get_irg_loop_depth(Pointer irg);
+	public static native int get_irg_recursion_depth(Pointer irg);
+	public static native double get_irg_method_execution_frequency(Pointer irg);
+	public static native void compute_callgraph();
+	public static native void free_callgraph();
+	public static native void callgraph_walk(callgraph_walk_func pre, callgraph_walk_func post, Pointer env);
+	public static native void find_callgraph_recursions();
+	public static native void compute_performance_estimates();
+	public static native void analyse_loop_nesting_depth();
+}
@@ -0,0 +1,22 @@
+package firm.bindings;
+
+import com.sun.jna.Native;
+import com.sun.jna.Pointer;
+
+/**
+ * Control dependence information from cdep.h, hand-written (see binding_irgwalk).
+ * find_cdep returns a list of struct ir_cdep { ir_node *node; ir_cdep *next; },
+ * read it with Pointer.getPointer().
+ */
+public class binding_cdep {
+	static { Native.register("firm"); }
+	
+	public static native void compute_cdep(Pointer irg);
+	public static native void free_cdep(Pointer irg);
+	public static native Pointer find_cdep(Pointer block);
+	public static native void exchange_cdep(Pointer old, Pointer nw);
+	public static native int is_cdep_on(Pointer dependee, Pointer candidate);
+	public static native int is_iterated_cdep_on(Pointer dependee, Pointer candidate);
+	public static native Pointer get_unique_cdep(Pointer block);
+	public static native int has_multiple_cdep(Pointer block);
+}
@@ -0,0 +1,19 @@
+package firm.bindings;
+
+import com.sun.jna.Native;
+import com.sun.jna.Pointer;
+import com.sun.jna.ptr.PointerByReference;
+
+/**
+ * Callee analysis from cgana.h, hand-written (see binding_irgwalk).
+ * The free_methods array returned by cgana must be released with
+ * binding_libc.free().
+ */
+public class binding_cgana {
+	static { Native.register("firm"); }
+	
+	public static native void cgana(int[] len, PointerByReference free_methods);
+	public static native void free_callee_info(Pointer irg);
+	public static native void free_irp_callee_info();
+	public static native void opt_call_addrs();
+}
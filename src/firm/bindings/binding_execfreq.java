@@ -0,0 +1,17 @@
+package firm.bindings;
+
+import com.sun.jna.Native;
+import com.sun.jna.NativeLong;
+import com.sun.jna.Pointer;
+
+/** Execution frequency estimates from execfreq.h, hand-written (see binding_irgwalk). */
+public class binding_execfreq {
+	static { Native.register("firm"); }
+	
+	public static native Pointer create_execfreq(Pointer irg);
+	public static native void set_execfreq(Pointer ef, Pointer block, double freq);
+	public static native Pointer compute_execfreq(Pointer irg, double loop_weight);
+	public static native void free_execfreq(Pointer ef);
+	public static native double get_block_execfreq(Pointer ef, Pointer block);
+	public static native NativeLong get_block_execfreq_ulong(Pointer ef, Pointer block);
+}
@@ -0,0 +1,16 @@
+package firm.bindings;
+
+import com.sun.jna.Native;
+import com.sun.jna.Pointer;
+
+/** Node heights from heights.h, hand-written (see binding_irgwalk). */
+public class binding_heights {
+	static { Native.register("firm"); }
+	
+	public static native /* unsigned */int get_irn_height(Pointer h, Pointer irn);
+	public static native int heights_reachable_in_block(Pointer h, Pointer n, Pointer m);
+	public static native void heights_recompute(Pointer h);
+	public static native /* unsigned */int heights_recompute_block(Pointer h, Pointer block);
+	public static native Pointer heights_new(Pointer irg);
+	public static native void heights_free(Pointer h);
+}
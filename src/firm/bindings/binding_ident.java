@@ -23,12 +23,10 @@ public class binding_ident {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<op_pin_state> lookup = new EnumLookup<op_pin_state>(values());
+
 		public static op_pin_state getEnum(int val) {
-			for(op_pin_state entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum cond_jmp_predicate {
@@ -46,12 +44,10 @@ public class binding_ident {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<cond_jmp_predicate> lookup = new EnumLookup<cond_jmp_predicate>(values());
+
 		public static cond_jmp_predicate getEnum(int val) {
-			for(cond_jmp_predicate entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum mtp_additional_property {
@@ -79,12 +75,10 @@ public class binding_ident {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<mtp_additional_property> lookup = new EnumLookup<mtp_additional_property>(values());
+
 		public static mtp_additional_property getEnum(int val) {
-			for(mtp_additional_property entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum symconst_kind {
@@ -105,12 +99,10 @@ public class binding_ident {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<symconst_kind> lookup = new EnumLookup<symconst_kind>(values());
+
 		public static symconst_kind getEnum(int val) {
-			for(symconst_kind entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_where_alloc {
@@ -127,12 +119,10 @@ public class binding_ident {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_where_alloc> lookup = new EnumLookup<ir_where_alloc>(values());
+
 		public static ir_where_alloc getEnum(int val) {
-			for(ir_where_alloc entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_builtin_kind {
@@ -161,12 +151,10 @@ public class binding_ident {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_builtin_kind> lookup = new EnumLookup<ir_builtin_kind>(values());
+
 		public static ir_builtin_kind getEnum(int val) {
-			for(ir_builtin_kind entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_generic {
@@ -185,12 +173,10 @@ public class binding_ident {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_generic> lookup = new EnumLookup<pn_generic>(values());
+
 		public static pn_generic getEnum(int val) {
-			for(pn_generic entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_value_classify_sign {
@@ -208,12 +194,10 @@ public class binding_ident {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_value_classify_sign> lookup = new EnumLookup<ir_value_classify_sign>(values());
+
 		public static ir_value_classify_sign getEnum(int val) {
-			for(ir_value_classify_sign entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static native Pointer new_id_from_str(String str);
@@ -23,12 +23,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<op_pin_state> lookup = new EnumLookup<op_pin_state>(values());
+
 		public static op_pin_state getEnum(int val) {
-			for(op_pin_state entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum cond_jmp_predicate {
@@ -46,12 +44,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<cond_jmp_predicate> lookup = new EnumLookup<cond_jmp_predicate>(values());
+
 		public static cond_jmp_predicate getEnum(int val) {
-			for(cond_jmp_predicate entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum mtp_additional_property {
@@ -79,12 +75,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<mtp_additional_property> lookup = new EnumLookup<mtp_additional_property>(values());
+
 		public static mtp_additional_property getEnum(int val) {
-			for(mtp_additional_property entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum symconst_kind {
@@ -105,12 +99,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<symconst_kind> lookup = new EnumLookup<symconst_kind>(values());
+
 		public static symconst_kind getEnum(int val) {
-			for(symconst_kind entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_where_alloc {
@@ -127,12 +119,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_where_alloc> lookup = new EnumLookup<ir_where_alloc>(values());
+
 		public static ir_where_alloc getEnum(int val) {
-			for(ir_where_alloc entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_builtin_kind {
@@ -161,12 +151,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_builtin_kind> lookup = new EnumLookup<ir_builtin_kind>(values());
+
 		public static ir_builtin_kind getEnum(int val) {
-			for(ir_builtin_kind entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_generic {
@@ -185,12 +173,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_generic> lookup = new EnumLookup<pn_generic>(values());
+
 		public static pn_generic getEnum(int val) {
-			for(pn_generic entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_value_classify_sign {
@@ -208,12 +194,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_value_classify_sign> lookup = new EnumLookup<ir_value_classify_sign>(values());
+
 		public static ir_value_classify_sign getEnum(int val) {
-			for(ir_value_classify_sign entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum firm_kind {
@@ -246,12 +230,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<firm_kind> lookup = new EnumLookup<firm_kind>(values());
+
 		public static firm_kind getEnum(int val) {
-			for(firm_kind entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_visibility {
@@ -270,12 +252,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_visibility> lookup = new EnumLookup<ir_visibility>(values());
+
 		public static ir_visibility getEnum(int val) {
-			for(ir_visibility entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_linkage {
@@ -296,12 +276,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_linkage> lookup = new EnumLookup<ir_linkage>(values());
+
 		public static ir_linkage getEnum(int val) {
-			for(ir_linkage entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_volatility {
@@ -318,12 +296,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_volatility> lookup = new EnumLookup<ir_volatility>(values());
+
 		public static ir_volatility getEnum(int val) {
-			for(ir_volatility entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_align {
@@ -340,12 +316,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_align> lookup = new EnumLookup<ir_align>(values());
+
 		public static ir_align getEnum(int val) {
-			for(ir_align entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_entity_usage {
@@ -366,12 +340,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_entity_usage> lookup = new EnumLookup<ir_entity_usage>(values());
+
 		public static ir_entity_usage getEnum(int val) {
-			for(ir_entity_usage entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_initializer_kind_t {
@@ -390,12 +362,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_initializer_kind_t> lookup = new EnumLookup<ir_initializer_kind_t>(values());
+
 		public static ir_initializer_kind_t getEnum(int val) {
-			for(ir_initializer_kind_t entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ptr_access_kind {
@@ -416,12 +386,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ptr_access_kind> lookup = new EnumLookup<ptr_access_kind>(values());
+
 		public static ptr_access_kind getEnum(int val) {
-			for(ptr_access_kind entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum tp_opcode {
@@ -449,12 +417,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<tp_opcode> lookup = new EnumLookup<tp_opcode>(values());
+
 		public static tp_opcode getEnum(int val) {
-			for(tp_opcode entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum inh_transitive_closure_state {
@@ -473,12 +439,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<inh_transitive_closure_state> lookup = new EnumLookup<inh_transitive_closure_state>(values());
+
 		public static inh_transitive_closure_state getEnum(int val) {
-			for(inh_transitive_closure_state entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_class_cast_state {
@@ -497,12 +461,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_class_cast_state> lookup = new EnumLookup<ir_class_cast_state>(values());
+
 		public static ir_class_cast_state getEnum(int val) {
-			for(ir_class_cast_state entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum trverify_error_codes {
@@ -527,12 +489,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<trverify_error_codes> lookup = new EnumLookup<trverify_error_codes>(values());
+
 		public static trverify_error_codes getEnum(int val) {
-			for(trverify_error_codes entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_type_state {
@@ -549,12 +509,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_type_state> lookup = new EnumLookup<ir_type_state>(values());
+
 		public static ir_type_state getEnum(int val) {
-			for(ir_type_state entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_variadicity {
@@ -571,12 +529,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_variadicity> lookup = new EnumLookup<ir_variadicity>(values());
+
 		public static ir_variadicity getEnum(int val) {
-			for(ir_variadicity entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum calling_convention {
@@ -599,12 +555,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<calling_convention> lookup = new EnumLookup<calling_convention>(values());
+
 		public static calling_convention getEnum(int val) {
-			for(calling_convention entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_allocation {
@@ -623,12 +577,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_allocation> lookup = new EnumLookup<ir_allocation>(values());
+
 		public static ir_allocation getEnum(int val) {
-			for(ir_allocation entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_peculiarity {
@@ -646,12 +598,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_peculiarity> lookup = new EnumLookup<ir_peculiarity>(values());
+
 		public static ir_peculiarity getEnum(int val) {
-			for(ir_peculiarity entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum __codecvt_result {
@@ -670,12 +620,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<__codecvt_result> lookup = new EnumLookup<__codecvt_result>(values());
+
 		public static __codecvt_result getEnum(int val) {
-			for(__codecvt_result entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_opcode {
@@ -767,12 +715,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_opcode> lookup = new EnumLookup<ir_opcode>(values());
+
 		public static ir_opcode getEnum(int val) {
-			for(ir_opcode entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum op_arity {
@@ -795,12 +741,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<op_arity> lookup = new EnumLookup<op_arity>(values());
+
 		public static op_arity getEnum(int val) {
-			for(op_arity entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum irop_flags {
@@ -833,12 +777,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<irop_flags> lookup = new EnumLookup<irop_flags>(values());
+
 		public static irop_flags getEnum(int val) {
-			for(irop_flags entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum dump_reason_t {
@@ -857,12 +799,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<dump_reason_t> lookup = new EnumLookup<dump_reason_t>(values());
+
 		public static dump_reason_t getEnum(int val) {
-			for(dump_reason_t entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_mode_sort_helper {
@@ -881,12 +821,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_mode_sort_helper> lookup = new EnumLookup<ir_mode_sort_helper>(values());
+
 		public static ir_mode_sort_helper getEnum(int val) {
-			for(ir_mode_sort_helper entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_mode_sort {
@@ -908,12 +846,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_mode_sort> lookup = new EnumLookup<ir_mode_sort>(values());
+
 		public static ir_mode_sort getEnum(int val) {
-			for(ir_mode_sort entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_mode_arithmetic {
@@ -936,12 +872,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_mode_arithmetic> lookup = new EnumLookup<ir_mode_arithmetic>(values());
+
 		public static ir_mode_arithmetic getEnum(int val) {
-			for(ir_mode_arithmetic entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_Alloc {
@@ -961,12 +895,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_Alloc> lookup = new EnumLookup<pn_Alloc>(values());
+
 		public static pn_Alloc getEnum(int val) {
-			for(pn_Alloc entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_Bound {
@@ -986,12 +918,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_Bound> lookup = new EnumLookup<pn_Bound>(values());
+
 		public static pn_Bound getEnum(int val) {
-			for(pn_Bound entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_Builtin {
@@ -1009,12 +939,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_Builtin> lookup = new EnumLookup<pn_Builtin>(values());
+
 		public static pn_Builtin getEnum(int val) {
-			for(pn_Builtin entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_Call {
@@ -1035,12 +963,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_Call> lookup = new EnumLookup<pn_Call>(values());
+
 		public static pn_Call getEnum(int val) {
-			for(pn_Call entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_Cmp {
@@ -1072,12 +998,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_Cmp> lookup = new EnumLookup<pn_Cmp>(values());
+
 		public static pn_Cmp getEnum(int val) {
-			for(pn_Cmp entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_Cond {
@@ -1095,12 +1019,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_Cond> lookup = new EnumLookup<pn_Cond>(values());
+
 		public static pn_Cond getEnum(int val) {
-			for(pn_Cond entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_CopyB {
@@ -1119,12 +1041,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_CopyB> lookup = new EnumLookup<pn_CopyB>(values());
+
 		public static pn_CopyB getEnum(int val) {
-			for(pn_CopyB entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_Div {
@@ -1144,12 +1064,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_Div> lookup = new EnumLookup<pn_Div>(values());
+
 		public static pn_Div getEnum(int val) {
-			for(pn_Div entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_DivMod {
@@ -1170,12 +1088,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_DivMod> lookup = new EnumLookup<pn_DivMod>(values());
+
 		public static pn_DivMod getEnum(int val) {
-			for(pn_DivMod entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_InstOf {
@@ -1195,12 +1111,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_InstOf> lookup = new EnumLookup<pn_InstOf>(values());
+
 		public static pn_InstOf getEnum(int val) {
-			for(pn_InstOf entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_Load {
@@ -1220,12 +1134,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_Load> lookup = new EnumLookup<pn_Load>(values());
+
 		public static pn_Load getEnum(int val) {
-			for(pn_Load entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_Mod {
@@ -1245,12 +1157,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_Mod> lookup = new EnumLookup<pn_Mod>(values());
+
 		public static pn_Mod getEnum(int val) {
-			for(pn_Mod entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_Quot {
@@ -1270,12 +1180,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_Quot> lookup = new EnumLookup<pn_Quot>(values());
+
 		public static pn_Quot getEnum(int val) {
-			for(pn_Quot entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_Raise {
@@ -1293,12 +1201,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_Raise> lookup = new EnumLookup<pn_Raise>(values());
+
 		public static pn_Raise getEnum(int val) {
-			for(pn_Raise entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_Start {
@@ -1319,12 +1225,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_Start> lookup = new EnumLookup<pn_Start>(values());
+
 		public static pn_Start getEnum(int val) {
-			for(pn_Start entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_Store {
@@ -1343,12 +1247,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_Store> lookup = new EnumLookup<pn_Store>(values());
+
 		public static pn_Store getEnum(int val) {
-			for(pn_Store entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_cons_flags {
@@ -1367,12 +1269,10 @@ public class binding_ircons {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_cons_flags> lookup = new EnumLookup<ir_cons_flags>(values());
+
 		public static ir_cons_flags getEnum(int val) {
-			for(ir_cons_flags entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static native void ir_init(Pointer params);
@@ -0,0 +1,48 @@
+package firm.bindings;
+
+import com.sun.jna.Native;
+import com.sun.jna.Pointer;
+
+import firm.bindings.binding_irgwalk.irg_walk_func;
+
+/** Dominator information from irdom.h, hand-written (see binding_irgwalk). */
+public class binding_irdom {
+	static { Native.register("firm"); }
+	
+	public static native Pointer get_Block_idom(Pointer bl);
+	public static native void set_Block_idom(Pointer bl, Pointer n);
+	public static native int get_Block_dom_depth(Pointer bl);
+	public static native void set_Block_dom_depth(Pointer bl, int depth);
+	public static native int get_Block_dom_pre_num(Pointer bl);
+	public static native void set_Block_dom_pre_num(Pointer bl, int num);
+	public static native Pointer get_Block_ipostdom(Pointer bl);
+	public static native void set_Block_ipostdom(Pointer bl, Pointer n);
+	public static native int get_Block_postdom_depth(Pointer bl);
+	public static native void set_Block_postdom_depth(Pointer bl, int depth);
+	public static native int get_Block_postdom_pre_num(Pointer bl);
+	public static native void set_Block_postdom_pre_num(Pointer bl, int num);
+	public static native /* unsigned */int get_Block_dom_tree_pre_num(Pointer bl);
+	public static native /* unsigned */int get_Block_pdom_tree_pre_num(Pointer bl);
+	public static native /* unsigned */int get_Block_dom_max_subtree_pre_num(Pointer bl);
+	public static native /* unsigned */int get_Block_pdom_max_subtree_pre_num(Pointer bl);
+	public static native Pointer get_Block_dominated_first(Pointer bl);
+	public static native Pointer get_Block_postdominated_first(Pointer bl);
+	public static native Pointer get_Block_dominated_next(Pointer dom);
+	public static native Pointer get_Block_postdominated_next(Pointer dom);
+	public static native int block_dominates(Pointer a, Pointer b);
+	public static native int block_strictly_dominates(Pointer a, Pointer b);
+	public static native Pointer node_smallest_common_dominator(Pointer a, Pointer b);
+	public static native Pointer node_users_smallest_common_dominator(Pointer irn, int handle_phi);
+	public static native int block_postdominates(Pointer a, Pointer b);
+	public static native int block_strictly_postdominates(Pointer a, Pointer b);
+	public static native void dom_tree_walk(Pointer n, irg_walk_func pre, irg_walk_func post, Pointer env);
+	public static native void postdom_tree_walk(Pointer n, irg_walk_func pre, irg_walk_func post, Pointer env);
+	public static native void dom_tree_walk_irg(Pointer irg, irg_walk_func pre, irg_walk_func post, Pointer env);
+	public static native void postdom_tree_walk_irg(Pointer irg, irg_walk_func pre, irg_walk_func post, Pointer env);
+	public static native void compute_doms(Pointer irg);
+	public static native void assure_doms(Pointer irg);
+	public static native void compute_postdoms(Pointer irg);
+	public static native void assure_postdoms(Pointer irg);
+	public static native void free_dom(Pointer irg);
+	public static native void free_postdom(Pointer irg);
+}
@@ -0,0 +1,34 @@
+package firm.bindings;
+
+import com.sun.jna.Callback;
+import com.sun.jna.Native;
+import com.sun.jna.NativeLong;
+import com.sun.jna.Pointer;
+
+/** Extended basic blocks from irextbb.h, hand-written (see binding_irgwalk). */
+public class binding_irextbb {
+	static { Native.register("firm"); }
+	
+	public interface extbb_walk_func extends Callback {
+		void callback(Pointer blk, Pointer env);
+	}
+	
+	public static native int is_ir_extbb(Pointer thing);
+	public static native void compute_extbb(Pointer irg);
+	public static native void compute_extbb_execfreqs(Pointer irg, Pointer execfreqs);
+	public static native void free_extbb(Pointer irg);
+	public static native Pointer get_nodes_extbb(Pointer node);
+	public static native NativeLong get_extbb_visited(Pointer blk);
+	public static native void set_extbb_visited(Pointer blk, NativeLong visited);
+	public static native void mark_extbb_visited(Pointer blk);
+	public static native int extbb_visited(Pointer blk);
+	public static native int extbb_not_visited(Pointer blk);
+	public static native Pointer get_extbb_link(Pointer blk);
+	public static native void set_extbb_link(Pointer blk, Pointer link);
+	public static native int get_extbb_n_blocks(Pointer blk);
+	public static native Pointer get_extbb_block(Pointer blk, int pos);
+	public static native Pointer get_extbb_leader(Pointer blk);
+	public static native NativeLong get_extbb_node_nr(Pointer blk);
+	public static native void irg_extblock_walk(Pointer blk, extbb_walk_func pre, extbb_walk_func post, Pointer env);
+	public static native void irg_extblock_walk_graph(Pointer irg, extbb_walk_func pre, extbb_walk_func post, Pointer env);
+}
@@ -0,0 +1,35 @@
+package firm.bindings;
+
+import com.sun.jna.Callback;
+import com.sun.jna.Native;
+import com.sun.jna.Pointer;
+
+/**
+ * Graph walkers from irgwalk.h.
+ *
+ * This and the other bindings without the "Automatically generated" header
+ * are written by hand: either the header is not one of those the bindings
+ * are generated from (cdep.h, cgana.h, execfreq.h, heights.h, vrp.h), or the
+ * generated bindings can't be used because they pass function pointers
+ * (and int out-parameters) as Pointer. Callbacks are declared as JNA
+ * Callback interfaces next to the functions taking them. Keep them in sync
+ * with the libfirm headers by hand.
+ */
+public class binding_irgwalk {
+	static { Native.register("firm"); }
+	
+	public interface irg_walk_func extends Callback {
+		void callback(Pointer node, Pointer env);
+	}
+	
+	public static native void irg_walk(Pointer node, irg_walk_func pre, irg_walk_func post, Pointer env);
+	public static native void irg_walk_graph(Pointer irg, irg_walk_func pre, irg_walk_func post, Pointer env);
+	public static native void irg_walk_in_or_dep_graph(Pointer irg, irg_walk_func pre, irg_walk_func post, Pointer env);
+	public static native void all_irg_walk(irg_walk_func pre, irg_walk_func post, Pointer env);
+	public static native void irg_block_walk(Pointer node, irg_walk_func pre, irg_walk_func post, Pointer env);
+	public static native void irg_block_walk_graph(Pointer irg, irg_walk_func pre, irg_walk_func post, Pointer env);
+	public static native void walk_const_code(irg_walk_func pre, irg_walk_func post, Pointer env);
+	public static native void irg_walk_blkwise_graph(Pointer irg, irg_walk_func pre, irg_walk_func post, Pointer env);
+	public static native void irg_walk_blkwise_dom_top_down(Pointer irg, irg_walk_func pre, irg_walk_func post, Pointer env);
+	public static native void irg_walk_anchors(Pointer irg, irg_walk_func pre, irg_walk_func post, Pointer env);
+}
@@ -0,0 +1,41 @@
+package firm.bindings;
+
+import com.sun.jna.Native;
+import com.sun.jna.Pointer;
+
+/**
+ * Loop tree and backedge information from irloop.h, hand-written (see
+ * binding_irgwalk). The loop_element union only contains pointers, so
+ * get_loop_element returns it as Pointer.
+ */
+public class binding_irloop {
+	static { Native.register("firm"); }
+	
+	public static native int is_backedge(Pointer n, int pos);
+	public static native void set_backedge(Pointer n, int pos);
+	public static native void set_not_backedge(Pointer n, int pos);
+	public static native int has_backedges(Pointer n);
+	public static native void clear_backedges(Pointer n);
+	public static native int is_ir_loop(Pointer thing);
+	public static native void set_irg_loop(Pointer irg, Pointer l);
+	public static native Pointer get_irg_loop(Pointer irg);
+	public static native Pointer get_irn_loop(Pointer n);
+	public static native Pointer get_loop_outer_loop(Pointer loop);
+	public static native int get_loop_depth(Pointer loop);
+	public static native int get_loop_n_sons(Pointer loop);
+	public static native Pointer get_loop_son(Pointer loop, int pos);
+	public static native int get_loop_n_nodes(Pointer loop);
+	public static native Pointer get_loop_node(Pointer loop, int pos);
+	public static native int get_loop_n_elements(Pointer loop);
+	public static native /* loop_element */Pointer get_loop_element(Pointer loop, int pos);
+	public static native int get_loop_element_pos(Pointer loop, Pointer le);
+	public static native int get_loop_loop_nr(Pointer loop);
+	public static native void set_loop_link(Pointer loop, Pointer link);
+	public static native Pointer get_loop_link(Pointer loop);
+	public static native int construct_backedges(Pointer irg);
+	public static native int construct_cf_backedges(Pointer irg);
+	public static native void assure_cf_loop(Pointer irg);
+	public static native void free_loop_information(Pointer irg);
+	public static native void free_all_loop_information();
+	public static native int is_loop_invariant(Pointer n, Pointer block);
+}
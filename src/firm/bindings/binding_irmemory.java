@@ -0,0 +1,102 @@
+package firm.bindings;
+
+import com.sun.jna.Callback;
+import com.sun.jna.Native;
+import com.sun.jna.Pointer;
+
+/** Memory disambiguation from irmemory.h, hand-written (see binding_irgwalk). */
+public class binding_irmemory {
+	static { Native.register("firm"); }
+	
+	public static enum ir_alias_relation {
+		ir_no_alias(),
+		ir_may_alias(),
+		ir_sure_alias();
+		public final int val;
+		private static class C { static int next_val; }
+
+		ir_alias_relation(int val) {
+			this.val = val;
+			C.next_val = val + 1;
+		}
+		ir_alias_relation() {
+			this.val = C.next_val++;
+		}
+		
+		private static final EnumLookup<ir_alias_relation> lookup = new EnumLookup<ir_alias_relation>(values());
+
+		public static ir_alias_relation getEnum(int val) {
+			return lookup.get(val);
+		}
+	}
+	
+	public static enum ir_entity_usage_computed_state {
+		ir_entity_usage_not_computed(),
+		ir_entity_usage_computed();
+		public final int val;
+		private static class C { static int next_val; }
+
+		ir_entity_usage_computed_state(int val) {
+			this.val = val;
+			C.next_val = val + 1;
+		}
+		ir_entity_usage_computed_state() {
+			this.val = C.next_val++;
+		}
+		
+		private static final EnumLookup<ir_entity_usage_computed_state> lookup = new EnumLookup<ir_entity_usage_computed_state>(values());
+
+		public static ir_entity_usage_computed_state getEnum(int val) {
+			return lookup.get(val);
+		}
+	}
+	
+	public static enum ir_disambuigator_options {
+		aa_opt_no_opt(0),
+		aa_opt_type_based(1),
+		aa_opt_byte_type_may_alias(2),
+		aa_opt_no_alias_args(4),
+		aa_opt_no_alias_args_global(8),
+		aa_opt_no_alias(16),
+		aa_opt_inherited(128);
+		public final int val;
+		private static class C { static int next_val; }
+
+		ir_disambuigator_options(int val) {
+			this.val = val;
+			C.next_val = val + 1;
+		}
+		ir_disambuigator_options() {
+			this.val = C.next_val++;
+		}
+		
+		private static final EnumLookup<ir_disambuigator_options> lookup = new EnumLookup<ir_disambuigator_options>(values());
+
+		public static ir_disambuigator_options getEnum(int val) {
+			return lookup.get(val);
+		}
+	}
+	
+	public interface DISAMBIGUATOR_FUNC extends Callback {
+		/* ir_alias_relation */int callback(Pointer adr1, Pointer mode1, Pointer adr2, Pointer mode2);
+	}
+	
+	public static native /* ir_storage_class_class_t */int classify_pointer(Pointer irn, Pointer ent);
+	public static native String get_ir_alias_relation_name(/* ir_alias_relation */int rel);
+	public static native /* ir_alias_relation */int get_alias_relation(Pointer adr1, Pointer mode1, Pointer adr2, Pointer mode2);
+	public static native void set_language_memory_disambiguator(DISAMBIGUATOR_FUNC func);
+	public static native void mem_disambig_init();
+	public static native /* ir_alias_relation */int get_alias_relation_ex(Pointer adr1, Pointer mode1, Pointer adr2, Pointer mode2);
+	public static native void mem_disambig_term();
+	public static native /* ir_entity_usage_computed_state */int get_irg_entity_usage_state(Pointer irg);
+	public static native void set_irg_entity_usage_state(Pointer irg, /* ir_entity_usage_computed_state */int state);
+	public static native void assure_irg_entity_usage_computed(Pointer irg);
+	public static native /* ir_entity_usage_computed_state */int get_irp_globals_entity_usage_state();
+	public static native void set_irp_globals_entity_usage_state(/* ir_entity_usage_computed_state */int state);
+	public static native void assure_irp_globals_entity_usage_computed();
+	public static native /* unsigned */int get_irg_memory_disambiguator_options(Pointer irg);
+	public static native void set_irg_memory_disambiguator_options(Pointer irg, /* unsigned */int options);
+	public static native void set_irp_memory_disambiguator_options(/* unsigned */int options);
+	public static native void mark_private_methods();
+	public static native Pointer mark_private_methods_pass(String name);
+}
@@ -23,12 +23,10 @@ public class binding_irop {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<__codecvt_result> lookup = new EnumLookup<__codecvt_result>(values());
+
 		public static __codecvt_result getEnum(int val) {
-			for(__codecvt_result entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum op_pin_state {
@@ -47,12 +45,10 @@ public class binding_irop {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<op_pin_state> lookup = new EnumLookup<op_pin_state>(values());
+
 		public static op_pin_state getEnum(int val) {
-			for(op_pin_state entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum cond_jmp_predicate {
@@ -70,12 +66,10 @@ public class binding_irop {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<cond_jmp_predicate> lookup = new EnumLookup<cond_jmp_predicate>(values());
+
 		public static cond_jmp_predicate getEnum(int val) {
-			for(cond_jmp_predicate entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum mtp_additional_property {
@@ -103,12 +97,10 @@ public class binding_irop {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<mtp_additional_property> lookup = new EnumLookup<mtp_additional_property>(values());
+
 		public static mtp_additional_property getEnum(int val) {
-			for(mtp_additional_property entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum symconst_kind {
@@ -129,12 +121,10 @@ public class binding_irop {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<symconst_kind> lookup = new EnumLookup<symconst_kind>(values());
+
 		public static symconst_kind getEnum(int val) {
-			for(symconst_kind entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_where_alloc {
@@ -151,12 +141,10 @@ public class binding_irop {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_where_alloc> lookup = new EnumLookup<ir_where_alloc>(values());
+
 		public static ir_where_alloc getEnum(int val) {
-			for(ir_where_alloc entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_builtin_kind {
@@ -185,12 +173,10 @@ public class binding_irop {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_builtin_kind> lookup = new EnumLookup<ir_builtin_kind>(values());
+
 		public static ir_builtin_kind getEnum(int val) {
-			for(ir_builtin_kind entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_generic {
@@ -209,12 +195,10 @@ public class binding_irop {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_generic> lookup = new EnumLookup<pn_generic>(values());
+
 		public static pn_generic getEnum(int val) {
-			for(pn_generic entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_value_classify_sign {
@@ -232,12 +216,10 @@ public class binding_irop {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_value_classify_sign> lookup = new EnumLookup<ir_value_classify_sign>(values());
+
 		public static ir_value_classify_sign getEnum(int val) {
-			for(ir_value_classify_sign entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_opcode {
@@ -329,12 +311,10 @@ public class binding_irop {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_opcode> lookup = new EnumLookup<ir_opcode>(values());
+
 		public static ir_opcode getEnum(int val) {
-			for(ir_opcode entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum op_arity {
@@ -357,12 +337,10 @@ public class binding_irop {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<op_arity> lookup = new EnumLookup<op_arity>(values());
+
 		public static op_arity getEnum(int val) {
-			for(op_arity entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum irop_flags {
@@ -395,12 +373,10 @@ public class binding_irop {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<irop_flags> lookup = new EnumLookup<irop_flags>(values());
+
 		public static irop_flags getEnum(int val) {
-			for(irop_flags entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum dump_reason_t {
@@ -419,12 +395,10 @@ public class binding_irop {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<dump_reason_t> lookup = new EnumLookup<dump_reason_t>(values());
+
 		public static dump_reason_t getEnum(int val) {
-			for(dump_reason_t entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static native Pointer new_id_from_str(String str);
@@ -23,12 +23,10 @@ public class binding_iroptimize {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<op_pin_state> lookup = new EnumLookup<op_pin_state>(values());
+
 		public static op_pin_state getEnum(int val) {
-			for(op_pin_state entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum cond_jmp_predicate {
@@ -46,12 +44,10 @@ public class binding_iroptimize {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<cond_jmp_predicate> lookup = new EnumLookup<cond_jmp_predicate>(values());
+
 		public static cond_jmp_predicate getEnum(int val) {
-			for(cond_jmp_predicate entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum mtp_additional_property {
@@ -79,12 +75,10 @@ public class binding_iroptimize {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<mtp_additional_property> lookup = new EnumLookup<mtp_additional_property>(values());
+
 		public static mtp_additional_property getEnum(int val) {
-			for(mtp_additional_property entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum symconst_kind {
@@ -105,12 +99,10 @@ public class binding_iroptimize {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<symconst_kind> lookup = new EnumLookup<symconst_kind>(values());
+
 		public static symconst_kind getEnum(int val) {
-			for(symconst_kind entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_where_alloc {
@@ -127,12 +119,10 @@ public class binding_iroptimize {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_where_alloc> lookup = new EnumLookup<ir_where_alloc>(values());
+
 		public static ir_where_alloc getEnum(int val) {
-			for(ir_where_alloc entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_builtin_kind {
@@ -161,12 +151,10 @@ public class binding_iroptimize {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_builtin_kind> lookup = new EnumLookup<ir_builtin_kind>(values());
+
 		public static ir_builtin_kind getEnum(int val) {
-			for(ir_builtin_kind entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_generic {
@@ -185,12 +173,10 @@ public class binding_iroptimize {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_generic> lookup = new EnumLookup<pn_generic>(values());
+
 		public static pn_generic getEnum(int val) {
-			for(pn_generic entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_value_classify_sign {
@@ -208,12 +194,10 @@ public class binding_iroptimize {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_value_classify_sign> lookup = new EnumLookup<ir_value_classify_sign>(values());
+
 		public static ir_value_classify_sign getEnum(int val) {
-			for(ir_value_classify_sign entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_Alloc {
@@ -233,12 +217,10 @@ public class binding_iroptimize {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_Alloc> lookup = new EnumLookup<pn_Alloc>(values());
+
 		public static pn_Alloc getEnum(int val) {
-			for(pn_Alloc entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_Bound {
@@ -258,12 +240,10 @@ public class binding_iroptimize {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_Bound> lookup = new EnumLookup<pn_Bound>(values());
+
 		public static pn_Bound getEnum(int val) {
-			for(pn_Bound entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_Builtin {
@@ -281,12 +261,10 @@ public class binding_iroptimize {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_Builtin> lookup = new EnumLookup<pn_Builtin>(values());
+
 		public static pn_Builtin getEnum(int val) {
-			for(pn_Builtin entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_Call {
@@ -307,12 +285,10 @@ public class binding_iroptimize {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_Call> lookup = new EnumLookup<pn_Call>(values());
+
 		public static pn_Call getEnum(int val) {
-			for(pn_Call entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_Cmp {
@@ -344,12 +320,10 @@ public class binding_iroptimize {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_Cmp> lookup = new EnumLookup<pn_Cmp>(values());
+
 		public static pn_Cmp getEnum(int val) {
-			for(pn_Cmp entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_Cond {
@@ -367,12 +341,10 @@ public class binding_iroptimize {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_Cond> lookup = new EnumLookup<pn_Cond>(values());
+
 		public static pn_Cond getEnum(int val) {
-			for(pn_Cond entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_CopyB {
@@ -391,12 +363,10 @@ public class binding_iroptimize {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_CopyB> lookup = new EnumLookup<pn_CopyB>(values());
+
 		public static pn_CopyB getEnum(int val) {
-			for(pn_CopyB entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_Div {
@@ -416,12 +386,10 @@ public class binding_iroptimize {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_Div> lookup = new EnumLookup<pn_Div>(values());
+
 		public static pn_Div getEnum(int val) {
-			for(pn_Div entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_DivMod {
@@ -442,12 +410,10 @@ public class binding_iroptimize {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_DivMod> lookup = new EnumLookup<pn_DivMod>(values());
+
 		public static pn_DivMod getEnum(int val) {
-			for(pn_DivMod entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_InstOf {
@@ -467,12 +433,10 @@ public class binding_iroptimize {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_InstOf> lookup = new EnumLookup<pn_InstOf>(values());
+
 		public static pn_InstOf getEnum(int val) {
-			for(pn_InstOf entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_Load {
@@ -492,12 +456,10 @@ public class binding_iroptimize {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_Load> lookup = new EnumLookup<pn_Load>(values());
+
 		public static pn_Load getEnum(int val) {
-			for(pn_Load entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_Mod {
@@ -517,12 +479,10 @@ public class binding_iroptimize {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_Mod> lookup = new EnumLookup<pn_Mod>(values());
+
 		public static pn_Mod getEnum(int val) {
-			for(pn_Mod entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_Quot {
@@ -542,12 +502,10 @@ public class binding_iroptimize {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_Quot> lookup = new EnumLookup<pn_Quot>(values());
+
 		public static pn_Quot getEnum(int val) {
-			for(pn_Quot entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_Raise {
@@ -565,12 +523,10 @@ public class binding_iroptimize {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_Raise> lookup = new EnumLookup<pn_Raise>(values());
+
 		public static pn_Raise getEnum(int val) {
-			for(pn_Raise entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_Start {
@@ -591,12 +547,10 @@ public class binding_iroptimize {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_Start> lookup = new EnumLookup<pn_Start>(values());
+
 		public static pn_Start getEnum(int val) {
-			for(pn_Start entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_Store {
@@ -615,12 +569,10 @@ public class binding_iroptimize {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_Store> lookup = new EnumLookup<pn_Store>(values());
+
 		public static pn_Store getEnum(int val) {
-			for(pn_Store entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum osr_flags {
@@ -639,12 +591,10 @@ public class binding_iroptimize {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<osr_flags> lookup = new EnumLookup<osr_flags>(values());
+
 		public static osr_flags getEnum(int val) {
-			for(osr_flags entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static native int is_ASM(Pointer node);
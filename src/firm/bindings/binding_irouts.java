@@ -0,0 +1,28 @@
+package firm.bindings;
+
+import com.sun.jna.Native;
+import com.sun.jna.Pointer;
+
+import firm.bindings.binding_irgwalk.irg_walk_func;
+
+/** Def-use (out) edges from irouts.h, hand-written (see binding_irgwalk). */
+public class binding_irouts {
+	static { Native.register("firm"); }
+	
+	public static native int get_irn_n_outs(Pointer node);
+	public static native Pointer get_irn_out(Pointer def, int pos);
+	public static native Pointer get_irn_out_ex(Pointer def, int pos, int[] in_pos);
+	public static native void set_irn_out(Pointer def, int pos, Pointer use, int in_pos);
+	public static native int get_Block_n_cfg_outs(Pointer node);
+	public static native int get_Block_n_cfg_outs_ka(Pointer node);
+	public static native Pointer get_Block_cfg_out(Pointer node, int pos);
+	public static native Pointer get_Block_cfg_out_ka(Pointer node, int pos);
+	public static native void irg_out_walk(Pointer node, irg_walk_func pre, irg_walk_func post, Pointer env);
+	public static native void irg_out_block_walk(Pointer node, irg_walk_func pre, irg_walk_func post, Pointer env);
+	public static native int get_irn_outs_computed(Pointer node);
+	public static native void compute_irg_outs(Pointer irg);
+	public static native void compute_irp_outs();
+	public static native void assure_irg_outs(Pointer irg);
+	public static native void free_irg_outs(Pointer irg);
+	public static native void free_irp_outs();
+}
@@ -0,0 +1,50 @@
+package firm.bindings;
+
+import com.sun.jna.Callback;
+import com.sun.jna.Native;
+import com.sun.jna.Pointer;
+
+/**
+ * Pass managers from irpass.h, hand-written (see binding_irgwalk).
+ * libfirm keeps the name pointers without copying them, so names are
+ * passed as Pointer and the caller has to keep the memory alive.
+ * The ir_graph_pass_t/ir_prog_pass_t constructors for the libfirm
+ * optimizations (opt_ldst_pass, ...) are in binding_iroptimize.
+ */
+public class binding_irpass {
+	static { Native.register("firm"); }
+	
+	public interface graph_func extends Callback {
+		void callback(Pointer irg);
+	}
+	
+	public interface graph_ret_func extends Callback {
+		int callback(Pointer irg);
+	}
+	
+	public interface prog_func extends Callback {
+		void callback();
+	}
+	
+	public interface context_func extends Callback {
+		void callback(Pointer context);
+	}
+	
+	public static native Pointer new_graph_pass_mgr(Pointer name, int verify_all, int dump_all);
+	public static native void ir_graph_pass_mgr_add(Pointer mgr, Pointer pass);
+	public static native int ir_graph_pass_mgr_run(Pointer mgr);
+	public static native void term_graph_pass_mgr(Pointer mgr);
+	public static native Pointer new_prog_pass_mgr(Pointer name, int verify_all, int dump_all);
+	public static native void ir_prog_pass_mgr_add(Pointer mgr, Pointer pass);
+	public static native void ir_prog_pass_mgr_add_graph_mgr(Pointer mgr, Pointer graph_mgr);
+	public static native void ir_prog_pass_mgr_add_graph_pass(Pointer mgr, Pointer pass);
+	public static native int ir_prog_pass_mgr_run(Pointer mgr);
+	public static native void term_prog_pass_mgr(Pointer mgr);
+	public static native void ir_graph_pass_mgr_set_run_idx(Pointer mgr, /* unsigned */int run_idx);
+	public static native Pointer def_graph_pass(Pointer name, graph_func function);
+	public static native Pointer def_graph_pass_ret(Pointer name, graph_ret_func function);
+	public static native void ir_graph_pass_set_parallel(Pointer pass, int flag);
+	public static native Pointer def_prog_pass(Pointer name, prog_func function);
+	public static native Pointer call_function_pass(Pointer name, context_func function, Pointer context);
+	public static native void ir_prog_pass_mgr_set_run_idx(Pointer mgr, /* unsigned */int run_idx);
+}
@@ -23,12 +23,10 @@ public class binding_irprog {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<op_pin_state> lookup = new EnumLookup<op_pin_state>(values());
+
 		public static op_pin_state getEnum(int val) {
-			for(op_pin_state entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum cond_jmp_predicate {
@@ -46,12 +44,10 @@ public class binding_irprog {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<cond_jmp_predicate> lookup = new EnumLookup<cond_jmp_predicate>(values());
+
 		public static cond_jmp_predicate getEnum(int val) {
-			for(cond_jmp_predicate entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum mtp_additional_property {
@@ -79,12 +75,10 @@ public class binding_irprog {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<mtp_additional_property> lookup = new EnumLookup<mtp_additional_property>(values());
+
 		public static mtp_additional_property getEnum(int val) {
-			for(mtp_additional_property entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum symconst_kind {
@@ -105,12 +99,10 @@ public class binding_irprog {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<symconst_kind> lookup = new EnumLookup<symconst_kind>(values());
+
 		public static symconst_kind getEnum(int val) {
-			for(symconst_kind entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_where_alloc {
@@ -127,12 +119,10 @@ public class binding_irprog {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_where_alloc> lookup = new EnumLookup<ir_where_alloc>(values());
+
 		public static ir_where_alloc getEnum(int val) {
-			for(ir_where_alloc entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_builtin_kind {
@@ -161,12 +151,10 @@ public class binding_irprog {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_builtin_kind> lookup = new EnumLookup<ir_builtin_kind>(values());
+
 		public static ir_builtin_kind getEnum(int val) {
-			for(ir_builtin_kind entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_generic {
@@ -185,12 +173,10 @@ public class binding_irprog {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_generic> lookup = new EnumLookup<pn_generic>(values());
+
 		public static pn_generic getEnum(int val) {
-			for(pn_generic entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_value_classify_sign {
@@ -208,12 +194,10 @@ public class binding_irprog {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_value_classify_sign> lookup = new EnumLookup<ir_value_classify_sign>(values());
+
 		public static ir_value_classify_sign getEnum(int val) {
-			for(ir_value_classify_sign entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum irg_phase_state {
@@ -232,12 +216,10 @@ public class binding_irprog {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<irg_phase_state> lookup = new EnumLookup<irg_phase_state>(values());
+
 		public static irg_phase_state getEnum(int val) {
-			for(irg_phase_state entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum irg_outs_state {
@@ -255,12 +237,10 @@ public class binding_irprog {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<irg_outs_state> lookup = new EnumLookup<irg_outs_state>(values());
+
 		public static irg_outs_state getEnum(int val) {
-			for(irg_outs_state entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum irg_extblk_info_state {
@@ -278,12 +258,10 @@ public class binding_irprog {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<irg_extblk_info_state> lookup = new EnumLookup<irg_extblk_info_state>(values());
+
 		public static irg_extblk_info_state getEnum(int val) {
-			for(irg_extblk_info_state entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum irg_dom_state {
@@ -301,12 +279,10 @@ public class binding_irprog {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<irg_dom_state> lookup = new EnumLookup<irg_dom_state>(values());
+
 		public static irg_dom_state getEnum(int val) {
-			for(irg_dom_state entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum irg_loopinfo_state {
@@ -334,12 +310,10 @@ public class binding_irprog {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<irg_loopinfo_state> lookup = new EnumLookup<irg_loopinfo_state>(values());
+
 		public static irg_loopinfo_state getEnum(int val) {
-			for(irg_loopinfo_state entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum irg_callee_info_state {
@@ -357,12 +331,10 @@ public class binding_irprog {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<irg_callee_info_state> lookup = new EnumLookup<irg_callee_info_state>(values());
+
 		public static irg_callee_info_state getEnum(int val) {
-			for(irg_callee_info_state entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum irg_inline_property {
@@ -382,12 +354,10 @@ public class binding_irprog {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<irg_inline_property> lookup = new EnumLookup<irg_inline_property>(values());
+
 		public static irg_inline_property getEnum(int val) {
-			for(irg_inline_property entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_resources_enum_t {
@@ -413,12 +383,10 @@ public class binding_irprog {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_resources_enum_t> lookup = new EnumLookup<ir_resources_enum_t>(values());
+
 		public static ir_resources_enum_t getEnum(int val) {
-			for(ir_resources_enum_t entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_graph_state_t {
@@ -436,12 +404,10 @@ public class binding_irprog {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_graph_state_t> lookup = new EnumLookup<ir_graph_state_t>(values());
+
 		public static ir_graph_state_t getEnum(int val) {
-			for(ir_graph_state_t entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_segment_t {
@@ -462,12 +428,10 @@ public class binding_irprog {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_segment_t> lookup = new EnumLookup<ir_segment_t>(values());
+
 		public static ir_segment_t getEnum(int val) {
-			for(ir_segment_t entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static native Pointer get_current_ir_graph();
@@ -9,6 +9,7 @@ public class binding_libc {
 	
 	public static native Pointer fopen(String name, String mode);
 	public static native void fclose(Pointer file);
+	public static native void free(Pointer ptr);
 	
 	public interface SigHandler extends Callback {
 		void callback(int arg);
@@ -23,12 +23,10 @@ public class binding_typerep {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<op_pin_state> lookup = new EnumLookup<op_pin_state>(values());
+
 		public static op_pin_state getEnum(int val) {
-			for(op_pin_state entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum cond_jmp_predicate {
@@ -46,12 +44,10 @@ public class binding_typerep {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<cond_jmp_predicate> lookup = new EnumLookup<cond_jmp_predicate>(values());
+
 		public static cond_jmp_predicate getEnum(int val) {
-			for(cond_jmp_predicate entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum mtp_additional_property {
@@ -79,12 +75,10 @@ public class binding_typerep {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<mtp_additional_property> lookup = new EnumLookup<mtp_additional_property>(values());
+
 		public static mtp_additional_property getEnum(int val) {
-			for(mtp_additional_property entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum symconst_kind {
@@ -105,12 +99,10 @@ public class binding_typerep {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<symconst_kind> lookup = new EnumLookup<symconst_kind>(values());
+
 		public static symconst_kind getEnum(int val) {
-			for(symconst_kind entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_where_alloc {
@@ -127,12 +119,10 @@ public class binding_typerep {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_where_alloc> lookup = new EnumLookup<ir_where_alloc>(values());
+
 		public static ir_where_alloc getEnum(int val) {
-			for(ir_where_alloc entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_builtin_kind {
@@ -161,12 +151,10 @@ public class binding_typerep {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_builtin_kind> lookup = new EnumLookup<ir_builtin_kind>(values());
+
 		public static ir_builtin_kind getEnum(int val) {
-			for(ir_builtin_kind entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum pn_generic {
@@ -185,12 +173,10 @@ public class binding_typerep {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<pn_generic> lookup = new EnumLookup<pn_generic>(values());
+
 		public static pn_generic getEnum(int val) {
-			for(pn_generic entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_value_classify_sign {
@@ -208,12 +194,10 @@ public class binding_typerep {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_value_classify_sign> lookup = new EnumLookup<ir_value_classify_sign>(values());
+
 		public static ir_value_classify_sign getEnum(int val) {
-			for(ir_value_classify_sign entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_visibility {
@@ -232,12 +216,10 @@ public class binding_typerep {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_visibility> lookup = new EnumLookup<ir_visibility>(values());
+
 		public static ir_visibility getEnum(int val) {
-			for(ir_visibility entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_linkage {
@@ -258,12 +240,10 @@ public class binding_typerep {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_linkage> lookup = new EnumLookup<ir_linkage>(values());
+
 		public static ir_linkage getEnum(int val) {
-			for(ir_linkage entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_volatility {
@@ -280,12 +260,10 @@ public class binding_typerep {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_volatility> lookup = new EnumLookup<ir_volatility>(values());
+
 		public static ir_volatility getEnum(int val) {
-			for(ir_volatility entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_align {
@@ -302,12 +280,10 @@ public class binding_typerep {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_align> lookup = new EnumLookup<ir_align>(values());
+
 		public static ir_align getEnum(int val) {
-			for(ir_align entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_entity_usage {
@@ -328,12 +304,10 @@ public class binding_typerep {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_entity_usage> lookup = new EnumLookup<ir_entity_usage>(values());
+
 		public static ir_entity_usage getEnum(int val) {
-			for(ir_entity_usage entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_initializer_kind_t {
@@ -352,12 +326,10 @@ public class binding_typerep {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_initializer_kind_t> lookup = new EnumLookup<ir_initializer_kind_t>(values());
+
 		public static ir_initializer_kind_t getEnum(int val) {
-			for(ir_initializer_kind_t entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ptr_access_kind {
@@ -378,12 +350,10 @@ public class binding_typerep {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ptr_access_kind> lookup = new EnumLookup<ptr_access_kind>(values());
+
 		public static ptr_access_kind getEnum(int val) {
-			for(ptr_access_kind entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum tp_opcode {
@@ -411,12 +381,10 @@ public class binding_typerep {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<tp_opcode> lookup = new EnumLookup<tp_opcode>(values());
+
 		public static tp_opcode getEnum(int val) {
-			for(tp_opcode entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum inh_transitive_closure_state {
@@ -435,12 +403,10 @@ public class binding_typerep {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<inh_transitive_closure_state> lookup = new EnumLookup<inh_transitive_closure_state>(values());
+
 		public static inh_transitive_closure_state getEnum(int val) {
-			for(inh_transitive_closure_state entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_class_cast_state {
@@ -459,12 +425,10 @@ public class binding_typerep {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_class_cast_state> lookup = new EnumLookup<ir_class_cast_state>(values());
+
 		public static ir_class_cast_state getEnum(int val) {
-			for(ir_class_cast_state entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum trverify_error_codes {
@@ -489,12 +453,10 @@ public class binding_typerep {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<trverify_error_codes> lookup = new EnumLookup<trverify_error_codes>(values());
+
 		public static trverify_error_codes getEnum(int val) {
-			for(trverify_error_codes entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_type_state {
@@ -511,12 +473,10 @@ public class binding_typerep {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_type_state> lookup = new EnumLookup<ir_type_state>(values());
+
 		public static ir_type_state getEnum(int val) {
-			for(ir_type_state entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_variadicity {
@@ -533,12 +493,10 @@ public class binding_typerep {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_variadicity> lookup = new EnumLookup<ir_variadicity>(values());
+
 		public static ir_variadicity getEnum(int val) {
-			for(ir_variadicity entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum calling_convention {
@@ -561,12 +519,10 @@ public class binding_typerep {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<calling_convention> lookup = new EnumLookup<calling_convention>(values());
+
 		public static calling_convention getEnum(int val) {
-			for(calling_convention entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_allocation {
@@ -585,12 +541,10 @@ public class binding_typerep {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_allocation> lookup = new EnumLookup<ir_allocation>(values());
+
 		public static ir_allocation getEnum(int val) {
-			for(ir_allocation entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static enum ir_peculiarity {
@@ -608,12 +562,10 @@ public class binding_typerep {
 			this.val = C.next_val++;
 		}
 		
+		private static final EnumLookup<ir_peculiarity> lookup = new EnumLookup<ir_peculiarity>(values());
+
 		public static ir_peculiarity getEnum(int val) {
-			for(ir_peculiarity entry : values()) {
-				if (val == entry.val)
-					return entry;
-			}
-			return null;
+			return lookup.get(val);
 		}
 	}
 	public static native /* ir_visibility */int get_entity_visibility(Pointer entity);
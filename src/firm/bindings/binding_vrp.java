@@ -0,0 +1,51 @@
+package firm.bindings;
+
+import com.sun.jna.Native;
+import com.sun.jna.Pointer;
+import com.sun.jna.Structure;
+
+/** Value range information from vrp.h, hand-written (see binding_irgwalk). */
+public class binding_vrp {
+	static { Native.register("firm"); }
+	
+	public static enum range_types {
+		VRP_UNDEFINED(),
+		VRP_RANGE(),
+		VRP_ANTIRANGE(),
+		VRP_VARYING();
+		public final int val;
+		private static class C { static int next_val; }
+
+		range_types(int val) {
+			this.val = val;
+			C.next_val = val + 1;
+		}
+		range_types() {
+			this.val = C.next_val++;
+		}
+		
+		private static final EnumLookup<range_types> lookup = new EnumLookup<range_types>(values());
+
+		public static range_types getEnum(int val) {
+			return lookup.get(val);
+		}
+	}
+	
+	public static class vrp_attr extends Structure {
+		public vrp_attr(Pointer ptr) {
+			super(ptr);
+			read();
+		}
+		
+		public int     valid;
+		public Pointer bits_set;
+		public Pointer bits_not_set;
+		public int     range_type;
+		public Pointer range_bottom;
+		public Pointer range_top;
+	}
+	
+	public static native void set_vrp_data(Pointer irg);
+	public static native /* pn_Cmp */int vrp_cmp(Pointer left, Pointer right);
+	public static native Pointer vrp_get_info(Pointer n);
+}
@@ -50,7 +50,7 @@ public class DivMod extends Node {
 	
 	public firm.Mode getResmode() {
 		Pointer _res = binding_irnode.get_DivMod_resmode(ptr);
-		return new firm.Mode(_res);
+		return firm.Mode.createWrapper(_res);
 	}
 
 	public void setResmode(firm.Mode _val) {
@@ -40,7 +40,7 @@ public class Load extends Node {
 	
 	public firm.Mode getLoadMode() {
 		Pointer _res = binding_irnode.get_Load_mode(ptr);
-		return new firm.Mode(_res);
+		return firm.Mode.createWrapper(_res);
 	}
 
 	public void setLoadMode(firm.Mode _val) {
@@ -1,6 +1,8 @@
 package firm.nodes;
 
-import java.nio.IntBuffer;
+import java.nio.Buffer;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
 import java.util.Iterator;
 
 import sun.reflect.generics.reflectiveObjects.NotImplementedException;
@@ -24,8 +26,13 @@ public abstract class Node extends JNAWrapper {
 		return new Graph(binding_irnode.get_irn_irg(ptr));
 	}
 	
+	/**
+	 * creates a wrapper object of the matching Node subclass.
+	 * Returns a cached wrapper if the node cache is enabled for the
+	 * graph of the node (see Graph.enableNodeCache()).
+	 */
 	public static Node createWrapper(Pointer ptr) {
-		return NodeWrapperConstruction.createWrapper(ptr);
+		return NodeCache.createWrapper(ptr);
 	}
 	
 	public static Pointer[] getPointerListFromNodeList(Node[] list) {
@@ -36,17 +43,57 @@ public abstract class Node extends JNAWrapper {
 		return ptrlist;
 	}
 	
-	public static IntBuffer getBufferFromNodeList(Node[] list) {
-		assert Pointer.SIZE == 4; // There is no PointerBuffer...
-		IntBuffer buf = IntBuffer.allocate(list.length);
+	/** buffers used to pass node arrays to native code, one per thread */
+	private static final ThreadLocal<ByteBuffer> pointerBuffer = new ThreadLocal<ByteBuffer>() {
+		@Override
+		protected ByteBuffer initialValue() {
+			return allocatePointerBuffer(16);
+		}
+	};
+	
+	private static ByteBuffer allocatePointerBuffer(int n) {
+		return ByteBuffer.allocateDirect(n * Pointer.SIZE).order(ByteOrder.nativeOrder());
+	}
+	
+	/**
+	 * returns a (direct) buffer with room for at least n native pointers.
+	 * The buffer is reused by the next call in the same thread, so it is only
+	 * valid until then (which is fine for passing arrays to firm functions as
+	 * they copy their inputs).
+	 */
+	public static ByteBuffer getPointerBuffer(int n) {
+		ByteBuffer buf = pointerBuffer.get();
+		if (buf.capacity() < n * Pointer.SIZE) {
+			buf = allocatePointerBuffer(Math.max(n, 2 * buf.capacity() / Pointer.SIZE));
+			pointerBuffer.set(buf);
+		}
+		return buf;
+	}
+	
+	/** stores a native pointer at array position i of a pointer buffer */
+	public static void putPointer(ByteBuffer buf, int i, Pointer ptr) {
+		long value = Pointer.nativeValue(ptr);
+		if (Pointer.SIZE == 8) {
+			buf.putLong(i * 8, value);
+		} else {
+			buf.putInt(i * 4, (int) value);
+		}
+	}
+	
+	/**
+	 * converts a node array into a native ir_node* array.
+	 * See getPointerBuffer() for the lifetime of the result.
+	 */
+	public static Buffer getBufferFromNodeList(Node[] list) {
+		ByteBuffer buf = getPointerBuffer(list.length);
 		for (int i = 0; i < list.length; ++i) {
-			buf.put(i, (int) Pointer.nativeValue(list[i].ptr));
+			putPointer(buf, i, list[i].ptr);
 		}
 		return buf;
 	}
 	
 	public Mode getMode() {
-		return new Mode(binding_irnode.get_irn_mode(ptr));
+		return Mode.createWrapper(binding_irnode.get_irn_mode(ptr));
 	}
 	
 	public int getPredCount() {
@@ -74,6 +121,14 @@ public abstract class Node extends JNAWrapper {
 		return binding_irnode.get_irn_node_nr(ptr).intValue();
 	}
 	
+	/**
+	 * returns the index of the node. Indices are dense and unique per graph
+	 * (in the range 0..Graph.getLastIdx()).
+	 */
+	public int getIdx() {
+		return binding_irnode.get_irn_idx(ptr);
+	}
+	
 	public class PredIterator implements Iterator<Node> {
 		private int i;
 
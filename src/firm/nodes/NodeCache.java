@@ -0,0 +1,102 @@
+package firm.nodes;
+
+import java.util.Arrays;
+import java.util.HashMap;
+import java.util.Map;
+
+import com.sun.jna.Pointer;
+
+import firm.bindings.binding_irnode;
+
+/**
+ * Optional per-graph cache of node wrappers.
+ * While the cache is enabled for a graph, Node.createWrapper returns the same
+ * wrapper object for the same firm node, so repeated getPred()/getBlock()/...
+ * calls don't produce new garbage and wrappers may be compared with ==.
+ * The wrappers are stored in a dense array indexed by the node index
+ * (get_irn_idx).
+ *
+ * A node changing its opcode (exchange, killNode, turnIntoTuple) makes its
+ * cached wrapper invalid. The Graph functions for these operations take
+ * care of this, after running native transformations you have to call
+ * Graph.clearNodeCache() yourself.
+ */
+public final class NodeCache {
+
+	private static final Map<Pointer, NodeCache> caches = new HashMap<Pointer, NodeCache>();
+
+	private Node[] nodes;
+
+	private NodeCache(int size) {
+		nodes = new Node[Math.max(size, 16)];
+	}
+
+	/**
+	 * enables the wrapper cache for a graph
+	 * @param irg        the graph
+	 * @param lastIdx    initial size of the cache (get_irg_last_idx)
+	 */
+	public static void enable(Pointer irg, int lastIdx) {
+		if (!caches.containsKey(irg))
+			caches.put(irg, new NodeCache(lastIdx));
+	}
+
+	/** disables the wrapper cache for a graph and drops all cached wrappers */
+	public static void disable(Pointer irg) {
+		caches.remove(irg);
+	}
+
+	/**
+	 * disables the wrapper caches of all graphs (the graph pointers are
+	 * reused after ir_finish)
+	 */
+	public static void clearAll() {
+		caches.clear();
+	}
+
+	public static boolean isEnabled(Pointer irg) {
+		return caches.containsKey(irg);
+	}
+
+	/** drops all cached wrappers of a graph (the cache stays enabled) */
+	public static void clear(Pointer irg) {
+		NodeCache cache = caches.get(irg);
+		if (cache != null)
+			Arrays.fill(cache.nodes, null);
+	}
+
+	/** drops the cached wrapper of a single node */
+	public static void invalidate(Node node) {
+		if (caches.isEmpty())
+			return;
+		NodeCache cache = caches.get(binding_irnode.get_irn_irg(node.ptr));
+		if (cache == null)
+			return;
+		int idx = binding_irnode.get_irn_idx(node.ptr);
+		if (idx < cache.nodes.length)
+			cache.nodes[idx] = null;
+	}
+
+	static Node createWrapper(Pointer ptr) {
+		if (caches.isEmpty())
+			return NodeWrapperConstruction.createWrapper(ptr);
+
+		NodeCache cache = caches.get(binding_irnode.get_irn_irg(ptr));
+		if (cache == null)
+			return NodeWrapperConstruction.createWrapper(ptr);
+
+		int idx = binding_irnode.get_irn_idx(ptr);
+		if (idx >= cache.nodes.length) {
+			Node[] newNodes = new Node[Math.max(idx + 1, cache.nodes.length * 2)];
+			System.arraycopy(cache.nodes, 0, newNodes, 0, cache.nodes.length);
+			cache.nodes = newNodes;
+		}
+
+		Node node = cache.nodes[idx];
+		if (node == null || !node.ptr.equals(ptr)) {
+			node = NodeWrapperConstruction.createWrapper(ptr);
+			cache.nodes[idx] = node;
+		}
+		return node;
+	}
+}
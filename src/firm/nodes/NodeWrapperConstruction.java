@@ -7,298 +7,533 @@ import firm.bindings.binding_irnode;
 
 class NodeWrapperConstruction {
 
-	public static Node createWrapper(Pointer ptr) {
-		final binding_irnode.ir_opcode opcode = 
-			binding_irnode.ir_opcode.getEnum(binding_irnode.get_irn_opcode(ptr));
+	private static abstract class Factory {
+		abstract Node create(Pointer ptr);
+	}
+
+	/** wrapper factories indexed by the raw opcode number */
+	private static final Factory[] factories = createFactories();
 
-		switch (opcode) {
+	private static Factory[] createFactories() {
+		final Factory[] result = new Factory[binding_irnode.ir_opcode.iro_MaxOpcode.val];
 		
 		
-			case iro_Add:
+		result[binding_irnode.ir_opcode.iro_Add.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Add(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Alloc:
+		result[binding_irnode.ir_opcode.iro_Alloc.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Alloc(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Anchor:
+		result[binding_irnode.ir_opcode.iro_Anchor.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Anchor(ptr);
+			}
+		};
 		
 		
 		
-			case iro_And:
+		result[binding_irnode.ir_opcode.iro_And.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new And(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Bad:
+		result[binding_irnode.ir_opcode.iro_Bad.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Bad(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Block:
+		result[binding_irnode.ir_opcode.iro_Block.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Block(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Borrow:
+		result[binding_irnode.ir_opcode.iro_Borrow.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Borrow(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Bound:
+		result[binding_irnode.ir_opcode.iro_Bound.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Bound(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Builtin:
+		result[binding_irnode.ir_opcode.iro_Builtin.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Builtin(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Call:
+		result[binding_irnode.ir_opcode.iro_Call.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Call(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Carry:
+		result[binding_irnode.ir_opcode.iro_Carry.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Carry(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Cast:
+		result[binding_irnode.ir_opcode.iro_Cast.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Cast(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Cmp:
+		result[binding_irnode.ir_opcode.iro_Cmp.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Cmp(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Cond:
+		result[binding_irnode.ir_opcode.iro_Cond.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Cond(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Confirm:
+		result[binding_irnode.ir_opcode.iro_Confirm.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Confirm(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Const:
+		result[binding_irnode.ir_opcode.iro_Const.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Const(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Conv:
+		result[binding_irnode.ir_opcode.iro_Conv.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Conv(ptr);
+			}
+		};
 		
 		
 		
-			case iro_CopyB:
+		result[binding_irnode.ir_opcode.iro_CopyB.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new CopyB(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Deleted:
+		result[binding_irnode.ir_opcode.iro_Deleted.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Deleted(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Div:
+		result[binding_irnode.ir_opcode.iro_Div.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Div(ptr);
+			}
+		};
 		
 		
 		
-			case iro_DivMod:
+		result[binding_irnode.ir_opcode.iro_DivMod.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new DivMod(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Dummy:
+		result[binding_irnode.ir_opcode.iro_Dummy.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Dummy(ptr);
+			}
+		};
 		
 		
 		
-			case iro_End:
+		result[binding_irnode.ir_opcode.iro_End.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new End(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Eor:
+		result[binding_irnode.ir_opcode.iro_Eor.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Eor(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Free:
+		result[binding_irnode.ir_opcode.iro_Free.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Free(ptr);
+			}
+		};
 		
 		
 		
-			case iro_IJmp:
+		result[binding_irnode.ir_opcode.iro_IJmp.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new IJmp(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Id:
+		result[binding_irnode.ir_opcode.iro_Id.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Id(ptr);
+			}
+		};
 		
 		
 		
-			case iro_InstOf:
+		result[binding_irnode.ir_opcode.iro_InstOf.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new InstOf(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Jmp:
+		result[binding_irnode.ir_opcode.iro_Jmp.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Jmp(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Load:
+		result[binding_irnode.ir_opcode.iro_Load.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Load(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Minus:
+		result[binding_irnode.ir_opcode.iro_Minus.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Minus(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Mod:
+		result[binding_irnode.ir_opcode.iro_Mod.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Mod(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Mul:
+		result[binding_irnode.ir_opcode.iro_Mul.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Mul(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Mulh:
+		result[binding_irnode.ir_opcode.iro_Mulh.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Mulh(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Mux:
+		result[binding_irnode.ir_opcode.iro_Mux.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Mux(ptr);
+			}
+		};
 		
 		
 		
-			case iro_NoMem:
+		result[binding_irnode.ir_opcode.iro_NoMem.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new NoMem(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Not:
+		result[binding_irnode.ir_opcode.iro_Not.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Not(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Or:
+		result[binding_irnode.ir_opcode.iro_Or.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Or(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Phi:
+		result[binding_irnode.ir_opcode.iro_Phi.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Phi(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Pin:
+		result[binding_irnode.ir_opcode.iro_Pin.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Pin(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Proj:
+		result[binding_irnode.ir_opcode.iro_Proj.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Proj(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Quot:
+		result[binding_irnode.ir_opcode.iro_Quot.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Quot(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Raise:
+		result[binding_irnode.ir_opcode.iro_Raise.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Raise(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Return:
+		result[binding_irnode.ir_opcode.iro_Return.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Return(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Rotl:
+		result[binding_irnode.ir_opcode.iro_Rotl.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Rotl(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Sel:
+		result[binding_irnode.ir_opcode.iro_Sel.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Sel(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Shl:
+		result[binding_irnode.ir_opcode.iro_Shl.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Shl(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Shr:
+		result[binding_irnode.ir_opcode.iro_Shr.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Shr(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Shrs:
+		result[binding_irnode.ir_opcode.iro_Shrs.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Shrs(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Start:
+		result[binding_irnode.ir_opcode.iro_Start.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Start(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Store:
+		result[binding_irnode.ir_opcode.iro_Store.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Store(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Sub:
+		result[binding_irnode.ir_opcode.iro_Sub.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Sub(ptr);
+			}
+		};
 		
 		
 		
-			case iro_SymConst:
+		result[binding_irnode.ir_opcode.iro_SymConst.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new SymConst(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Sync:
+		result[binding_irnode.ir_opcode.iro_Sync.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Sync(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Tuple:
+		result[binding_irnode.ir_opcode.iro_Tuple.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Tuple(ptr);
+			}
+		};
 		
 		
 		
-			case iro_Unknown:
+		result[binding_irnode.ir_opcode.iro_Unknown.val] = new Factory() {
+			@Override
+			Node create(Pointer ptr) {
 				return new Unknown(ptr);
+			}
+		};
 		
 		
 		
 		
 		
 		
-			default:
-				throw new IllegalStateException("Unkown node type: " + opcode);
+		return result;
+	}
+
+	public static Node createWrapper(Pointer ptr) {
+		final int opcode = binding_irnode.get_irn_opcode(ptr);
+		if (opcode < 0 || opcode >= factories.length || factories[opcode] == null) {
+			throw new IllegalStateException("Unkown node type: "
+					+ binding_irnode.ir_opcode.getEnum(opcode));
 		}
+		return factories[opcode].create(ptr);
 	}
 }
\ No newline at end of file
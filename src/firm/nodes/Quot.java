@@ -50,7 +50,7 @@ public class Quot extends Node {
 	
 	public firm.Mode getResmode() {
 		Pointer _res = binding_irnode.get_Quot_resmode(ptr);
-		return new firm.Mode(_res);
+		return firm.Mode.createWrapper(_res);
 	}
 
 	public void setResmode(firm.Mode _val) {